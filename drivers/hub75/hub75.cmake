@@ -6,6 +6,6 @@ target_sources(hub75 INTERFACE
 target_include_directories(hub75 INTERFACE ${CMAKE_CURRENT_LIST_DIR})
 
 # Pull in pico libraries that we need
-target_link_libraries(hub75 INTERFACE pico_stdlib hardware_pio hardware_dma)
+target_link_libraries(hub75 INTERFACE pico_stdlib hardware_pio hardware_dma pico_graphics)
 
 pico_generate_pio_header(hub75 ${CMAKE_CURRENT_LIST_DIR}/hub75.pio)
\ No newline at end of file
@@ -1,9 +1,42 @@
 #include <cstring>
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "hub75.hpp"
 
+using namespace pimoroni;
+
+// Gamma corrected channel values for each PicoGraphics pen format, already
+// shifted into place in a Pixel so that update() only needs to OR them together
+template<uint bits, uint shift>
+static constexpr std::array<uint32_t, 1 << bits> gamma_channel() {
+    std::array<uint32_t, 1 << bits> lut{};
+    const uint max = (1 << bits) - 1;
+    for(auto i = 0u; i <= max; i++) {
+        // scale up to 8-bit so that full brightness stays full brightness
+        lut[i] = uint32_t(GAMMA_10BIT[(i * 255 + max / 2) / max]) << shift;
+    }
+    return lut;
+}
+
+static constexpr auto rgb565_r_lut = gamma_channel<5, 0>();
+static constexpr auto rgb565_g_lut = gamma_channel<6, 10>();
+static constexpr auto rgb565_b_lut = gamma_channel<5, 20>();
+
+static constexpr std::array<uint32_t, 256> rgb332_gamma() {
+    std::array<uint32_t, 256> lut{};
+    auto r = gamma_channel<3, 0>();
+    auto g = gamma_channel<3, 10>();
+    auto b = gamma_channel<2, 20>();
+    for(auto i = 0u; i < 256; i++) {
+        lut[i] = r[(i >> 5) & 0b111] | g[(i >> 2) & 0b111] | b[i & 0b11];
+    }
+    return lut;
+}
+
+static constexpr auto rgb332_lut = rgb332_gamma();
+
 
 // Basic function to convert Hue, Saturation and Value to an RGB colour
 Pixel hsv_to_rgb(float h, float s, float v) {
@@ -37,7 +70,7 @@ Pixel hsv_to_rgb(float h, float s, float v) {
 }
 
 Hub75::Hub75(uint width, uint height, Pixel *buffer, PanelType panel_type, bool inverted_stb)
- : width(width), height(height), panel_type(panel_type), inverted_stb(inverted_stb)
+ : DisplayDriver(width, height, ROTATE_0), panel_type(panel_type), inverted_stb(inverted_stb)
  {
     // Set up allllll the GPIO
     gpio_init(pin_r0); gpio_set_function(pin_r0, GPIO_FUNC_SIO); gpio_set_dir(pin_r0, true); gpio_put(pin_r0, 0);
@@ -268,6 +301,52 @@ void Hub75::flip(bool copybuffer) {
     };
 }
 
+void Hub75::update(PicoGraphics *graphics) {
+    // RGB332 and P8 framebuffers are read as they are, other pens convert to RGB565
+    PicoGraphics::PenType type = graphics->pen_type;
+    if(type == PicoGraphics::PEN_P8) {
+        PicoGraphics_PenP8 *p8 = (PicoGraphics_PenP8 *)graphics;
+        for(auto i = 0u; i < PicoGraphics_PenP8::palette_size; i++) {
+            RGB c = p8->palette[i];
+            palette_lut[i] = Pixel(c.r, c.g, c.b).color;
+        }
+    } else if(type != PicoGraphics::PEN_RGB332) {
+        type = PicoGraphics::PEN_RGB565;
+    }
+
+    uint y = 0;
+    graphics->scanline_convert(type, [&](void *data, size_t length) {
+        if(y >= height) return;
+
+        // the top and bottom halves of the panel are interleaved in the buffer
+        Pixel *dst = y < height / 2u
+            ? &front_buffer[y * width * 2]
+            : &front_buffer[(y - height / 2u) * width * 2 + 1];
+        y++;
+
+        if(type == PicoGraphics::PEN_RGB565) {
+            uint16_t *src = (uint16_t *)data;
+            uint count = std::min(length / sizeof(uint16_t), (size_t)width);
+            while(count--) {
+                uint16_t c = __builtin_bswap16(*src++);
+                *dst = rgb565_r_lut[c >> 11] | rgb565_g_lut[(c >> 5) & 0x3f] | rgb565_b_lut[c & 0x1f];
+                dst += 2;
+            }
+        } else {
+            const uint32_t *lut = type == PicoGraphics::PEN_P8 ? palette_lut : rgb332_lut.data();
+            uint8_t *src = (uint8_t *)data;
+            uint count = std::min(length, (size_t)width);
+            while(count--) {
+                *dst = lut[*src++];
+                dst += 2;
+            }
+        }
+    });
+
+    // every frame is drawn in full, so the new front buffer is cleared rather than copied
+    flip(false);
+}
+
 void Hub75::dma_complete() {
     if(dma_channel_get_irq1_status(dma_flip_channel)) {
         dma_channel_acknowledge_irq1(dma_flip_channel);
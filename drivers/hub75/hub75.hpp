@@ -1,3 +1,5 @@
+#pragma once
+
 #include <stdint.h>
 #include "pico/stdlib.h"
 
@@ -5,6 +7,7 @@
 #include "hardware/dma.h"
 #include "hardware/irq.h"
 #include "hub75.pio.h"
+#include "libraries/pico_graphics/pico_graphics.hpp"
 
 const uint DATA_BASE_PIN = 0;
 const uint DATA_N_PINS = 6;
@@ -48,10 +51,8 @@ enum PanelType {
 
 Pixel hsv_to_rgb(float h, float s, float v);
 
-class Hub75 {
+class Hub75 : public pimoroni::DisplayDriver {
     public:
-    uint width;
-    uint height;
     Pixel *front_buffer;
     Pixel *back_buffer;
     bool managed_buffer = false;
@@ -110,6 +111,9 @@ class Hub75 {
     unsigned int pin_led_g = 17;
     unsigned int pin_led_b = 18;
 
+    // Gamma corrected colours for each entry of a PEN_P8 palette, rebuilt by update()
+    uint32_t palette_lut[256];
+
     Hub75(uint width, uint height, Pixel *buffer) : Hub75(width, height, buffer, PANEL_GENERIC, false) {};
     Hub75(uint width, uint height, Pixel *buffer, PanelType panel_type) : Hub75(width, height, buffer, panel_type, false) {};
     Hub75(uint width, uint height, Pixel *buffer, PanelType panel_type, bool inverted_stb);
@@ -126,4 +130,7 @@ class Hub75 {
     void stop(irq_handler_t handler);
     void flip(bool copybuffer=true);
     void dma_complete();
+
+    // Draws a PicoGraphics framebuffer and flips it onto the panel, call start() first
+    void update(pimoroni::PicoGraphics *graphics) override;
 };
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "led_matrix.hpp"
+#include "common/pimoroni_common.hpp"
+
+using namespace pimoroni;
+
+namespace plasma {
+
+LEDMatrix::LEDMatrix(uint16_t width, uint16_t height, WS2812 &strip, uint16_t *map)
+ : DisplayDriver(width, height, ROTATE_0), buffer((uint32_t *)strip.buffer), num_leds(strip.num_leds), ws2812(&strip) {
+    // the first byte in the buffer is the first colour sent to the LED
+    switch(strip.color_order) {
+        case WS2812::COLOR_ORDER::RGB: r_shift = 0;  g_shift = 8;  b_shift = 16; break;
+        case WS2812::COLOR_ORDER::RBG: r_shift = 0;  g_shift = 16; b_shift = 8;  break;
+        case WS2812::COLOR_ORDER::GRB: r_shift = 8;  g_shift = 0;  b_shift = 16; break;
+        case WS2812::COLOR_ORDER::GBR: r_shift = 16; g_shift = 0;  b_shift = 8;  break;
+        case WS2812::COLOR_ORDER::BRG: r_shift = 8;  g_shift = 16; b_shift = 0;  break;
+        case WS2812::COLOR_ORDER::BGR: r_shift = 16; g_shift = 8;  b_shift = 0;  break;
+    }
+    // white is left off on RGBW strips
+    keep_mask = 0;
+    init_map(map);
+}
+
+LEDMatrix::LEDMatrix(uint16_t width, uint16_t height, APA102 &strip, uint16_t *map)
+ : DisplayDriver(width, height, ROTATE_0), buffer((uint32_t *)strip.buffer), num_leds(strip.num_leds), apa102(&strip) {
+    // start of frame and brightness, then blue, green and red
+    r_shift = 24;
+    g_shift = 16;
+    b_shift = 8;
+    keep_mask = 0x000000ff;
+    init_map(map);
+}
+
+void LEDMatrix::init_map(uint16_t *map) {
+    this->map = map;
+    if(this->map == nullptr) {
+        this->map = new uint16_t[width * height];
+        managed_map = true;
+        set_layout(width, height);
+    }
+}
+
+void LEDMatrix::set_layout(uint16_t panel_width, uint16_t panel_height, bool serpentine, bool columns) {
+    uint panels_across = (width + panel_width - 1) / panel_width;
+    uint panel_size = panel_width * panel_height;
+
+    for(auto y = 0u; y < height; y++) {
+        for(auto x = 0u; x < width; x++) {
+            uint panel = (y / panel_height) * panels_across + x / panel_width;
+            uint px = x % panel_width;
+            uint py = y % panel_height;
+
+            uint led;
+            if(columns) {
+                if(serpentine && (px & 1)) py = panel_height - 1 - py;
+                led = px * panel_height + py;
+            } else {
+                if(serpentine && (py & 1)) px = panel_width - 1 - px;
+                led = py * panel_width + px;
+            }
+            led += panel * panel_size;
+
+            map[y * width + x] = led < num_leds ? led : NO_LED;
+        }
+    }
+}
+
+uint32_t LEDMatrix::pack(uint8_t r, uint8_t g, uint8_t b) {
+    if(gamma) {
+        r = GAMMA[r];
+        g = GAMMA[g];
+        b = GAMMA[b];
+    }
+    r = (r * brightness) / 255;
+    g = (g * brightness) / 255;
+    b = (b * brightness) / 255;
+    return ((uint32_t)r << r_shift) | ((uint32_t)g << g_shift) | ((uint32_t)b << b_shift);
+}
+
+// scales a channel of max+1 levels up to 0-255
+static uint8_t expand(uint v, uint max) {
+    return (v * 255 + max / 2) / max;
+}
+
+void LEDMatrix::update(PicoGraphics *graphics) {
+    // RGB332 and P8 framebuffers are read as they are, other pens convert to
+    // RGB565. Each channel's gamma, brightness and position in the LED's word
+    // is worked out once per update rather than once per pixel.
+    PicoGraphics::PenType type = graphics->pen_type;
+    if(type == PicoGraphics::PEN_P8) {
+        PicoGraphics_PenP8 *p8 = (PicoGraphics_PenP8 *)graphics;
+        for(auto i = 0u; i < PicoGraphics_PenP8::palette_size; i++) {
+            RGB c = p8->palette[i];
+            lut[i] = pack(c.r, c.g, c.b);
+        }
+    } else if(type == PicoGraphics::PEN_RGB332) {
+        for(auto i = 0u; i < 256; i++) {
+            lut[i] = pack(expand(i >> 5, 7), expand((i >> 2) & 0b111, 7), expand(i & 0b11, 3));
+        }
+    } else {
+        type = PicoGraphics::PEN_RGB565;
+        // red, green and blue tables one after another
+        for(auto i = 0u; i < 32; i++) lut[i] = pack(expand(i, 31), 0, 0);
+        for(auto i = 0u; i < 64; i++) lut[32 + i] = pack(0, expand(i, 63), 0);
+        for(auto i = 0u; i < 32; i++) lut[96 + i] = pack(0, 0, expand(i, 31));
+    }
+
+    uint y = 0;
+    graphics->scanline_convert(type, [&](void *data, size_t length) {
+        if(y >= height) return;
+        const uint16_t *leds = &map[y * width];
+        y++;
+
+        if(type == PicoGraphics::PEN_RGB565) {
+            uint16_t *src = (uint16_t *)data;
+            uint count = std::min(length / sizeof(uint16_t), (size_t)width);
+            for(auto x = 0u; x < count; x++) {
+                uint16_t led = leds[x];
+                if(led >= num_leds) continue;
+                uint16_t c = __builtin_bswap16(src[x]);
+                buffer[led] = (buffer[led] & keep_mask) | lut[c >> 11] | lut[32 + ((c >> 5) & 0x3f)] | lut[96 + (c & 0x1f)];
+            }
+        } else {
+            uint8_t *src = (uint8_t *)data;
+            uint count = std::min(length, (size_t)width);
+            for(auto x = 0u; x < count; x++) {
+                uint16_t led = leds[x];
+                if(led >= num_leds) continue;
+                buffer[led] = (buffer[led] & keep_mask) | lut[src[x]];
+            }
+        }
+    });
+
+    // starts sending the buffer unless the strip is already mid-update
+    if(ws2812) ws2812->update();
+    if(apa102) apa102->update();
+}
+
+}
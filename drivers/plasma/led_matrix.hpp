@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ws2812.hpp"
+#include "apa102.hpp"
+#include "libraries/pico_graphics/pico_graphics.hpp"
+
+namespace plasma {
+
+    // Draws a PicoGraphics framebuffer onto a strip of WS2812 or APA102 LEDs
+    // laid out as a matrix. Each pixel is looked up in an index table to find
+    // its LED, so any wiring (serpentine rows, chained panels, hand made maps)
+    // costs the same to update.
+    class LEDMatrix : public pimoroni::DisplayDriver {
+        public:
+            static const uint16_t NO_LED = UINT16_MAX;
+
+            // index table, one LED index (or NO_LED) per pixel in row order
+            uint16_t *map;
+            bool gamma = true;
+
+            LEDMatrix(uint16_t width, uint16_t height, WS2812 &strip, uint16_t *map=nullptr);
+            LEDMatrix(uint16_t width, uint16_t height, APA102 &strip, uint16_t *map=nullptr);
+            ~LEDMatrix() {
+                if(managed_map) {
+                    delete[] map;
+                }
+            }
+
+            // Fills the index table for a grid of panels chained left to right
+            // then top to bottom. Each panel is wired from its top left corner
+            // along rows (or columns), with serpentine panels reversing every
+            // other row (or column).
+            void set_layout(uint16_t panel_width, uint16_t panel_height, bool serpentine=false, bool columns=false);
+            void set_index(uint16_t x, uint16_t y, uint16_t led) {map[y * width + x] = led;};
+
+            void update(pimoroni::PicoGraphics *graphics) override;
+            void set_backlight(uint8_t brightness) override {this->brightness = brightness;};
+
+        private:
+            uint32_t *buffer;
+            uint32_t num_leds;
+            WS2812 *ws2812 = nullptr;
+            APA102 *apa102 = nullptr;
+            bool managed_map = false;
+            uint8_t brightness = 255;
+
+            // bit offsets of each channel within an LED's 32-bit buffer word,
+            // and the bits that must be kept (APA102 global brightness)
+            uint r_shift, g_shift, b_shift;
+            uint32_t keep_mask;
+
+            // buffer words for the current pen type, rebuilt by each update
+            uint32_t lut[256];
+
+            void init_map(uint16_t *map);
+            uint32_t pack(uint8_t r, uint8_t g, uint8_t b);
+    };
+}
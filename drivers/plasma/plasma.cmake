@@ -15,4 +15,13 @@ target_link_libraries(${DRIVER_NAME} INTERFACE
     )
 
 pico_generate_pio_header(${DRIVER_NAME} ${CMAKE_CURRENT_LIST_DIR}/apa102.pio)
-pico_generate_pio_header(${DRIVER_NAME} ${CMAKE_CURRENT_LIST_DIR}/ws2812.pio)
\ No newline at end of file
+pico_generate_pio_header(${DRIVER_NAME} ${CMAKE_CURRENT_LIST_DIR}/ws2812.pio)
+
+# PicoGraphics display driver for LED matrices, kept separate so plain strips don't need pico_graphics
+add_library(plasma_matrix INTERFACE)
+
+target_sources(plasma_matrix INTERFACE
+  ${CMAKE_CURRENT_LIST_DIR}/led_matrix.cpp
+)
+
+target_link_libraries(plasma_matrix INTERFACE plasma pico_graphics)
@@ -5,44 +5,55 @@
 #include <string.h>
 
 namespace pimoroni {
-  
+
+  // control bytes, a command followed by another control byte or the rest
+  // of the transfer as display data
+  static const uint8_t CONTROL_COMMAND = 0x80;
+  static const uint8_t CONTROL_DATA    = 0x40;
+
+  void SH1107::write_page(uint page, uint column, const uint8_t *data, uint length) {
+    // page and column address then the data, all in one transaction
+    uint8_t buf[7 + length];
+    buf[0] = CONTROL_COMMAND; buf[1] = 0xb0 + page;
+    buf[2] = CONTROL_COMMAND; buf[3] = 0x00 | (column & 0x0f);
+    buf[4] = CONTROL_COMMAND; buf[5] = 0x10 | (column >> 4);
+    buf[6] = CONTROL_DATA;
+    memcpy(buf + 7, data, length);
+
+    i2c.write_blocking(0x3c, buf, sizeof(buf), false);
+  }
+
   void SH1107::update(PicoGraphics *graphics) {
-    if(graphics->pen_type == PicoGraphics::PEN_1BIT) { // Display buffer is screen native
+    if(graphics->pen_type == PicoGraphics::PEN_1BIT_PAGED) { // Display buffer is screen native
+      PicoGraphics_Pen1BitPaged *paged = (PicoGraphics_Pen1BitPaged *)graphics;
+      uint8_t *p = (uint8_t *)graphics->frame_buffer;
+
+      // only the columns drawn into since the last update are sent
+      for(auto page = 0u; page < paged->pages; page++) {
+        uint start = paged->dirty_start[page];
+        uint end = std::min(uint(paged->dirty_end[page]), uint(width));
+        if(start >= end) continue;
+        write_page(page, start, &p[page * width + start], end - start);
+      }
 
+      paged->clear_dirty();
+    } else if(graphics->pen_type == PicoGraphics::PEN_1BIT) {
+      // rows of pixels are turned into pages of eight rows a page at a time
       uint8_t *p = (uint8_t *)graphics->frame_buffer;
-      uint framebuffer_size = PicoGraphics_Pen1Bit::buffer_size(width, height);
-      uint page_size = framebuffer_size / 16;
-
-      uint8_t temp[framebuffer_size] = {0};
-      uint8_t *ptemp = temp;
-
-      for(int y = 0; y < height; y++) {
-        for(int x = 0; x < width; x++) {
-          uint bo = 7 - (x & 0b111);
-          uint8_t color = p[(x / 8) + (y * width / 8)] & (1U << bo);
-          if(color) {
-            temp[x + (y / 8 ) * width] |= 1 << (y % 8);
-          }else{
-            temp[x + (y / 8 ) * width] &= ~(1 << (y % 8));
+      uint8_t page_buf[width];
+
+      for(auto page = 0u; page < height / 8u; page++) {
+        memset(page_buf, 0, width);
+        for(auto row = 0u; row < 8; row++) {
+          uint8_t *src = &p[(page * 8 + row) * width / 8];
+          for(auto x = 0u; x < width; x++) {
+            if(src[x / 8] & (0x80 >> (x & 0b111))) {
+              page_buf[x] |= 1U << row;
+            }
           }
         }
+        write_page(page, 0, page_buf, width);
       }
-
-      uint8_t buf[page_size + 1];
-
-      for(int i = 0; i < 16; i++) {
-        i2c.reg_write_uint8(0x3c, 0, 0xb0 + i);
-        i2c.reg_write_uint8(0x3c, 0, 0x00);
-        i2c.reg_write_uint8(0x3c, 0, 0x10);
-
-        memcpy(buf + 1, ptemp, page_size);
-        buf[0] = 0x40;
-
-        i2c.write_blocking(0x3c, buf, page_size + 1, false);
-
-        ptemp += page_size;
-      }
-      
     }
   }
 
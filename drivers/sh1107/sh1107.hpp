@@ -75,10 +75,14 @@ namespace pimoroni {
       i2c.reg_write_uint8(0x3c, 0, 0xaf); // turn display on
     }
 
+    // Sends a PicoGraphics_Pen1BitPaged framebuffer as it is, and only the
+    // parts of it that have changed. PicoGraphics_Pen1Bit is rearranged
+    // into pages and sent in full.
     void update(PicoGraphics *graphics) override;
 
   private:
     void common_init();
+    void write_page(uint page, uint column, const uint8_t *data, uint length);
     void command(uint8_t command, size_t len = 0, const char *data = NULL);
   };
 
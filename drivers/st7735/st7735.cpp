@@ -1,6 +1,8 @@
 #include "st7735.hpp"
 
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
 #include <math.h>
 
 #include "hardware/dma.h"
@@ -78,6 +80,15 @@ namespace pimoroni {
     gpio_set_function(sck, GPIO_FUNC_SPI);
     gpio_set_function(mosi, GPIO_FUNC_SPI);
 
+    // pixel data goes out as 16-bit SPI frames, byte swapped from the
+    // framebuffer's big endian RGB565
+    dma_channel = dma_claim_unused_channel(true);
+    dma_channel_config config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_bswap(&config, true);
+    channel_config_set_dreq(&config, spi_get_dreq(spi, true));
+    dma_channel_configure(dma_channel, &config, &spi_get_hw(spi)->dr, NULL, 0, false);
+
     // if a backlight pin is provided then set it up for
     // pwm control
     if(bl != PIN_UNUSED) {
@@ -150,6 +161,8 @@ namespace pimoroni {
   }
 
   void ST7735::command(uint8_t command, size_t len, const char *data) {
+    wait_for_update();
+
     gpio_put(cs, 0);
 
     gpio_put(dc, 0); // command mode
@@ -163,20 +176,70 @@ namespace pimoroni {
     gpio_put(cs, 1);
   }
 
-  // Native 16-bit framebuffer update
   void ST7735::update(PicoGraphics *graphics) {
+    update_async(graphics);
+    wait_for_update();
+  }
+
+  // Returns once the last of the frame is queued for DMA. A native 16-bit
+  // framebuffer goes out in one transfer straight from the framebuffer, other
+  // pens are converted a row at a time while the previous row is being sent.
+  void ST7735::update_async(PicoGraphics *graphics) {
+    command(reg::RAMWR);
+    gpio_put(dc, 1); // data mode
+    gpio_put(cs, 0);
+    spi_set_format(spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    transfer_active = true;
+
     if(graphics->pen_type == PicoGraphics::PEN_RGB565) {
-      command(reg::RAMWR, width * height * sizeof(uint16_t), (const char*)graphics->frame_buffer);
+      start_dma(graphics->frame_buffer, width * height * sizeof(uint16_t));
     } else {
-      command(reg::RAMWR);
-      gpio_put(dc, 1); // data mode
-      gpio_put(cs, 0);
-
-      graphics->scanline_convert(PicoGraphics::PEN_RGB565, [this](void *data, size_t length) {
-        spi_write_blocking(spi, (const uint8_t*)data, length);
+      uint buffer = 0;
+      graphics->scanline_convert(PicoGraphics::PEN_RGB565, [this, &buffer](void *data, size_t length) {
+        length = std::min(length, sizeof(line_buffers[0]));
+        // the DMA may still be reading this buffer from two rows ago
+        dma_channel_wait_for_finish_blocking(dma_channel);
+        memcpy(line_buffers[buffer], data, length);
+        start_dma(line_buffers[buffer], length);
+        buffer ^= 1;
       });
+    }
+  }
 
+  void ST7735::start_dma(const void *src, size_t len) {
+    dma_channel_set_trans_count(dma_channel, len / sizeof(uint16_t), false);
+    dma_channel_set_read_addr(dma_channel, src, true);
+  }
+
+  bool ST7735::is_busy() {
+    if(!transfer_active) return false;
+    if(dma_channel_is_busy(dma_channel) || spi_is_busy(spi)) return true;
+
+    // throw away what was received while sending, as spi_write_blocking does
+    while(spi_is_readable(spi))
+      (void)spi_get_hw(spi)->dr;
+    spi_get_hw(spi)->icr = SPI_SSPICR_RORIC_BITS;
+    spi_set_format(spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+
+    gpio_put(cs, 1);
+    transfer_active = false;
+    return false;
+  }
+
+  void ST7735::wait_for_update() {
+    while(is_busy())
+      ;
+  }
+
+  void ST7735::cleanup() {
+    if(dma_channel_is_claimed(dma_channel)) {
+      dma_channel_abort(dma_channel);
+      dma_channel_unclaim(dma_channel);
+    }
+    if(transfer_active) {
+      spi_set_format(spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
       gpio_put(cs, 1);
+      transfer_active = false;
     }
   }
 
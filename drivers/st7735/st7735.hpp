@@ -37,6 +37,10 @@ namespace pimoroni {
     uint8_t offset_cols = 0;
     uint8_t offset_rows = 0;
 
+    // converted rows are sent by DMA from one buffer while the next is filled
+    uint16_t line_buffers[2][ROWS];
+    bool transfer_active = false;
+
     //--------------------------------------------------
     // Constructors/Destructor
     //--------------------------------------------------
@@ -53,11 +57,16 @@ namespace pimoroni {
     //--------------------------------------------------
   public:
     void update(PicoGraphics *graphics) override;
+    void update_async(PicoGraphics *graphics) override;
+    bool is_busy() override;
+    void wait_for_update();
     void set_backlight(uint8_t brightness) override;
+    void cleanup() override;
 
   private:
     void init(bool auto_init_sequence = true);
     void command(uint8_t command, size_t len = 0, const char *data = NULL);
+    void start_dma(const void *src, size_t len);
   };
 
 }
@@ -1,8 +1,11 @@
 #include "st7789.hpp"
 
 #include <cstdlib>
+#include <cstring>
 #include <math.h>
 
+#include "hardware/sync.h"
+
 namespace pimoroni {
   uint8_t madctl;
   uint16_t caset[2] = {0, 0};
@@ -47,8 +50,10 @@ namespace pimoroni {
   };
 
   void ST7789::common_init() {
-    gpio_set_function(dc, GPIO_FUNC_SIO);
-    gpio_set_dir(dc, GPIO_OUT);
+    if(!pio_serial) { // otherwise DC belongs to the PIO
+      gpio_set_function(dc, GPIO_FUNC_SIO);
+      gpio_set_dir(dc, GPIO_OUT);
+    }
 
     gpio_set_function(cs, GPIO_FUNC_SIO);
     gpio_set_dir(cs, GPIO_OUT);
@@ -109,12 +114,133 @@ namespace pimoroni {
     }
   }
 
+  // displays with DMA updates, by channel, for the shared interrupt handler
+  static ST7789 *dma_displays[NUM_DMA_CHANNELS];
+
+  void ST7789::dma_irq_handler() {
+    for(auto channel = 0u; channel < NUM_DMA_CHANNELS; channel++) {
+      if(dma_displays[channel] && dma_channel_get_irq0_status(channel)) {
+        dma_channel_acknowledge_irq0(channel);
+        dma_displays[channel]->dma_complete();
+      }
+    }
+  }
+
+  void ST7789::init_dma_irq() {
+    bool first = true;
+    for(auto display : dma_displays) {
+      if(display) first = false;
+    }
+    dma_displays[dma_channel] = this;
+
+    // DMA_IRQ_0 may be in use elsewhere, so the handler is shared
+    if(first) {
+      irq_add_shared_handler(DMA_IRQ_0, dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+      irq_set_enabled(DMA_IRQ_0, true);
+    }
+    dma_channel_set_irq0_enabled(dma_channel, true);
+  }
+
+  // displays with their TE output wired up, by pin
+  static ST7789 *vsync_displays[NUM_BANK0_GPIOS];
+
+  void ST7789::vsync_irq_handler() {
+    for(auto pin = 0u; pin < NUM_BANK0_GPIOS; pin++) {
+      if(vsync_displays[pin] && (gpio_get_irq_event_mask(pin) & GPIO_IRQ_EDGE_RISE)) {
+        gpio_acknowledge_irq(pin, GPIO_IRQ_EDGE_RISE);
+        vsync_displays[pin]->vsync_edge();
+      }
+    }
+  }
+
+  void ST7789::set_vsync(uint pin, uint interval) {
+    if(vsync != PIN_UNUSED) {
+      gpio_set_irq_enabled(vsync, GPIO_IRQ_EDGE_RISE, false);
+      gpio_remove_raw_irq_handler(vsync, vsync_irq_handler);
+      vsync_displays[vsync] = nullptr;
+    }
+
+    // an update still waiting for an edge goes now
+    if(waiting_for_vsync) {
+      waiting_for_vsync = false;
+      launch_first_dma();
+    }
+
+    vsync = pin;
+    frame_interval = std::max(interval, 1u);
+    frame_started = false;
+    missed_vsyncs = 0;
+    if(vsync == PIN_UNUSED) return;
+
+    // TE pulses high during vertical blanking only
+    command(reg::TEON, 1, "\x00");
+
+    gpio_set_function(vsync, GPIO_FUNC_SIO);
+    gpio_set_dir(vsync, GPIO_IN);
+    gpio_set_pulls(vsync, false, true);
+
+    vsync_displays[vsync] = this;
+    gpio_add_raw_irq_handler(vsync, vsync_irq_handler);
+    gpio_set_irq_enabled(vsync, GPIO_IRQ_EDGE_RISE, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+  }
+
+  void ST7789::vsync_edge() {
+    uint32_t count = ++vsync_count;
+    if(!waiting_for_vsync) return;
+
+    uint32_t elapsed = count - last_frame_vsync;
+    if(frame_started) {
+      if(elapsed < frame_interval) return;
+      missed_vsyncs += elapsed - frame_interval;
+    }
+    last_frame_vsync = count;
+    frame_started = true;
+
+    waiting_for_vsync = false;
+    launch_first_dma();
+  }
+
+  void ST7789::wait_for_vsync() {
+    uint32_t count = vsync_count;
+    while(vsync != PIN_UNUSED && vsync_count == count) {
+      tight_loop_contents();
+    }
+  }
+
+  uint32_t ST7789::get_missed_vsyncs() {
+    uint32_t status = save_and_disable_interrupts();
+    uint32_t missed = missed_vsyncs;
+    missed_vsyncs = 0;
+    restore_interrupts(status);
+    return missed;
+  }
+
   void ST7789::cleanup() {
-    if(spi) return; // SPI mode needs no tear down
-    if(dma_channel_is_claimed(parallel_dma)) {
-      dma_channel_abort(parallel_dma);
-      dma_channel_unclaim(parallel_dma);
+    set_vsync(PIN_UNUSED);
+
+    if(dma_channel_is_claimed(dma_channel)) {
+      dma_channel_set_irq0_enabled(dma_channel, false);
+      dma_channel_abort(dma_channel);
+      dma_channel_acknowledge_irq0(dma_channel);
+      dma_channel_unclaim(dma_channel);
+
+      dma_displays[dma_channel] = nullptr;
+      bool last = true;
+      for(auto display : dma_displays) {
+        if(display) last = false;
+      }
+      if(last) irq_remove_handler(DMA_IRQ_0, dma_irq_handler);
     }
+    if(pio_serial && dma_channel_is_claimed(control_channel)) {
+      dma_channel_abort(control_channel);
+      dma_channel_unclaim(control_channel);
+    }
+    chain = nullptr;
+    busy = false;
+    waiting_for_vsync = false;
+
+    if(spi) return; // SPI mode needs no more tear down
 
     if(pio_sm_is_claimed(parallel_pio, parallel_sm)) {
       pio_sm_set_enabled(parallel_pio, parallel_sm, false);
@@ -223,13 +349,6 @@ namespace pimoroni {
     command(reg::MADCTL, 1, (char *)&madctl);
   }
 
-  void ST7789::write_blocking_parallel_dma(const uint8_t *src, size_t len) {
-    while (dma_channel_is_busy(parallel_dma))
-      ;
-    dma_channel_set_trans_count(parallel_dma, len, false);
-    dma_channel_set_read_addr(parallel_dma, src, true);
-  }
-
   void ST7789::write_blocking_parallel(const uint8_t *src, size_t len) {
     const uint8_t *p = src;
     while(len--) {
@@ -256,7 +375,31 @@ namespace pimoroni {
     }*/
   }
 
+  void ST7789::write_blocking_serial(bool data, const uint8_t *src, size_t len) {
+    pio_sm_put_blocking(parallel_pio, parallel_sm, (data ? 0x80000000u : 0) | (len * 8 - 1));
+    for(size_t i = 0; i < len; i += 2) {
+      uint32_t pair = uint32_t(src[i]) << 24;
+      if(i + 1 < len) pair |= uint32_t(src[i + 1]) << 16;
+      pio_sm_put_blocking(parallel_pio, parallel_sm, pair);
+    }
+
+    uint32_t sm_stall_mask = 1u << (parallel_sm + PIO_FDEBUG_TXSTALL_LSB);
+    parallel_pio->fdebug = sm_stall_mask;
+    while (!(parallel_pio->fdebug & sm_stall_mask))
+      ;
+  }
+
   void ST7789::command(uint8_t command, size_t len, const char *data) {
+    wait_for_update();
+
+    if(pio_serial) {
+      gpio_put(cs, 0);
+      write_blocking_serial(false, &command, 1);
+      if(data) write_blocking_serial(true, (const uint8_t*)data, len);
+      gpio_put(cs, 1);
+      return;
+    }
+
     gpio_put(dc, 0); // command mode
 
     gpio_put(cs, 0);
@@ -280,42 +423,266 @@ namespace pimoroni {
   }
   
   void ST7789::update(PicoGraphics *graphics) {
-    uint8_t cmd = reg::RAMWR;
+    update_async(graphics);
+    wait_for_update();
+  }
 
-    if(graphics->pen_type == PicoGraphics::PEN_RGB565) { // Display buffer is screen native
-      command(cmd, width * height * sizeof(uint16_t), (const char*)graphics->frame_buffer);
-    } else if(spi) { // SPI Bus
-      gpio_put(dc, 0); // command mode
-      gpio_put(cs, 0);
-      spi_write_blocking(spi, &cmd, 1);
-      gpio_put(dc, 1); // data mode
+  void ST7789::update_async(PicoGraphics *graphics) {
+    // a framebuffer that divides into the panel is pixel doubled (or more) to fill it
+    uint scale = graphics->bounds.w > 0 ? width / graphics->bounds.w : 1;
+    if(scale < 1 || graphics->bounds.w * scale != width || graphics->bounds.h * scale != height) scale = 1;
 
-      graphics->scanline_convert(PicoGraphics::PEN_RGB565, [this](void *data, size_t length) {
-        spi_write_blocking(spi, (const uint8_t*)data, length);
-      });
-  
-      gpio_put(cs, 1);
-    } else { // Parallel Bus
-      gpio_put(dc, 0); // command mode
-      gpio_put(cs, 0);
+    start_transfer(graphics, graphics->bounds, scale);
+  }
+
+  bool ST7789::is_busy() {
+    return busy;
+  }
+
+  void ST7789::wait_for_update() {
+    while(busy) {
+      tight_loop_contents();
+    }
+  }
+
+  void ST7789::start_transfer(PicoGraphics *graphics, const Rect &region, uint scale) {
+    wait_for_update();
+
+    uint8_t cmd = reg::RAMWR;
+    gpio_put(dc, 0); // command mode
+    gpio_put(cs, 0);
+    if(spi) {
+      spi_write_blocking(spi, &cmd, 1);
+      spi_set_format(spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    } else if(!pio_serial) {
       write_blocking_parallel(&cmd, 1);
-      gpio_put(dc, 1); // data mode
+    }
+    gpio_put(dc, 1); // data mode
 
-      int scanline = 0;
+    busy = true;
 
-      graphics->scanline_convert(PicoGraphics::PEN_RGB565, [this, scanline](void *data, size_t length) mutable {
-        write_blocking_parallel_dma((const uint8_t*)data, length);
+    uint16_t *src = (uint16_t *)graphics->frame_buffer;
+    bool native = graphics->pen_type == PicoGraphics::PEN_RGB565 && scale == 1;
 
-        // Stall on the last scanline since "data" goes out of scope and is lost
-        scanline++;
-        if(scanline == height) {
-            while (dma_channel_is_busy(parallel_dma))
-            ;
+    if(pio_serial) {
+      // the window, RAMWR and the header for the pixel data go first in the chain
+      Rect window(region.x * scale, region.y * scale, region.w * scale, region.h * scale);
+      uint words = build_preamble(window, window.w * window.h * sizeof(uint16_t));
+
+      if(native && region.w != graphics->bounds.w && region.h < (int32_t)count_of(row_blocks)) {
+        // chain each row of the region straight from the framebuffer
+        ControlBlock *block = row_blocks;
+        *block++ = {ctrl_words, preamble, &parallel_pio->txf[parallel_sm], words};
+        for(auto y = region.y; y < region.y + region.h; y++) {
+          bool last = y == region.y + region.h - 1;
+          *block++ = {last ? ctrl_pixels_last : ctrl_pixels, &src[y * graphics->bounds.w + region.x], &parallel_pio->txf[parallel_sm], uint32_t(region.w)};
         }
-      });
+        chain = row_blocks;
+        pending_length = 0;
+        start_first_dma(nullptr, 0);
+        return;
+      }
+    }
 
-      gpio_put(cs, 1);
+    if(native && region.x == 0 && region.w == graphics->bounds.w) {
+      // the framebuffer is screen native and the rows follow on from each other, send them in one go
+      pending_length = 0;
+      start_first_dma(&src[region.y * region.w], region.w * region.h * sizeof(uint16_t));
+      return;
+    }
+
+    transfer_graphics = graphics;
+    transfer_region = region;
+    transfer_scale = scale;
+    transfer_line = 0;
+
+    // fill both buffers up front so that the interrupt always has the next one ready
+    size_t length = fill_line_buffer(line_buffers[0]);
+    pending_length = fill_line_buffer(line_buffers[1]);
+    sending = 0;
+    start_first_dma(line_buffers[0], length);
+  }
+
+  size_t ST7789::fill_line_buffer(uint16_t *buffer) {
+    uint line_width = transfer_region.w * transfer_scale;
+    uint lines = BUFFER_PIXELS / line_width;
+    uint total = transfer_region.h * transfer_scale;
+    if(transfer_line >= total) return 0;
+
+    // every framebuffer row the buffer needs is converted in one call, so
+    // that the pen's setup for a conversion (eg: the P8 palette lookup) is
+    // done once per buffer rather than once per row
+    fill_pointer = buffer;
+    fill_line = transfer_line;
+    fill_end = std::min(transfer_line + lines, total);
+    uint first_row = fill_line / transfer_scale;
+    uint last_row = (fill_end - 1) / transfer_scale;
+    Rect rows(transfer_region.x, transfer_region.y + first_row, transfer_region.w, last_row - first_row + 1);
+
+    transfer_graphics->scanline_convert(PicoGraphics::PEN_RGB565, rows, [this](void *data, size_t length) {
+      uint16_t *src = (uint16_t *)data;
+      uint count = length / sizeof(uint16_t);
+      uint line_width = count * transfer_scale;
+      if(transfer_scale == 1) {
+        memcpy(fill_pointer, src, length);
+      } else {
+        uint16_t *dst = fill_pointer;
+        for(auto x = 0u; x < count; x++) {
+          for(auto s = 0u; s < transfer_scale; s++) {
+            *dst++ = src[x];
+          }
+        }
+      }
+
+      // repeat it for the rest of the lines from this row in the buffer
+      uint row_end = std::min((fill_line / transfer_scale + 1) * transfer_scale, fill_end);
+      for(fill_line++, fill_pointer += line_width; fill_line < row_end; fill_line++, fill_pointer += line_width) {
+        memcpy(fill_pointer, fill_pointer - line_width, line_width * sizeof(uint16_t));
+      }
+    });
+
+    size_t length = (fill_end - transfer_line) * line_width * sizeof(uint16_t);
+    transfer_line = fill_end;
+    return length;
+  }
+
+  uint ST7789::build_preamble(const Rect &window, size_t pixel_bytes) {
+    uint n = 0;
+    // headers count bits, and the bytes after them go two to a word in the top half
+    auto packet = [this, &n](bool data, uint32_t length) {
+      preamble[n++] = (data ? 0x80000000u : 0) | (length * 8 - 1);
+    };
+    auto byte = [this, &n](uint8_t b) {
+      preamble[n++] = uint32_t(b) << 24;
+    };
+    auto pair = [this, &n](uint8_t a, uint8_t b) {
+      preamble[n++] = uint32_t(a) << 24 | uint32_t(b) << 16;
+    };
+
+    // caset and raset hold the (byte swapped) window for the whole panel
+    uint16_t x = __builtin_bswap16(caset[0]) + window.x;
+    uint16_t y = __builtin_bswap16(raset[0]) + window.y;
+    uint16_t r = x + window.w - 1;
+    uint16_t b = y + window.h - 1;
+
+    packet(false, 1); byte(reg::CASET);
+    packet(true, 4); pair(x >> 8, x & 0xff); pair(r >> 8, r & 0xff);
+    packet(false, 1); byte(reg::RASET);
+    packet(true, 4); pair(y >> 8, y & 0xff); pair(b >> 8, b & 0xff);
+    packet(false, 1); byte(reg::RAMWR);
+    packet(true, pixel_bytes);
+
+    return n;
+  }
+
+  void ST7789::start_first_dma(const void *src, size_t len) {
+    first_src = src;
+    first_length = len;
+
+    if(pio_serial && !chain) {
+      control_blocks[0] = {ctrl_words, preamble, &parallel_pio->txf[parallel_sm], PREAMBLE_WORDS};
+      control_blocks[1] = {ctrl_pixels_last, src, &parallel_pio->txf[parallel_sm], uint32_t(len / sizeof(uint16_t))};
+      chain = control_blocks;
     }
+
+    if(vsync == PIN_UNUSED) {
+      launch_first_dma();
+    } else {
+      // leave it to the next TE edge
+      waiting_for_vsync = true;
+    }
+  }
+
+  void ST7789::launch_first_dma() {
+    if(chain) {
+      ControlBlock *blocks = chain;
+      chain = nullptr;
+      dma_channel_set_read_addr(control_channel, blocks, true);
+    } else {
+      start_dma(first_src, first_length);
+    }
+  }
+
+  void ST7789::start_dma(const void *src, size_t len) {
+    // SPI and PIO serial transfers are 16-bit, parallel ones a byte at a time
+    dma_channel_set_trans_count(dma_channel, spi || pio_serial ? len / sizeof(uint16_t) : len, false);
+    dma_channel_set_read_addr(dma_channel, src, true);
+  }
+
+  void ST7789::dma_complete() {
+    if(pending_length == 0) {
+      finish_transfer();
+      return;
+    }
+
+    // send the buffer that's ready straight away, then refill the one that just went
+    sending ^= 1;
+    start_dma(line_buffers[sending], pending_length);
+    pending_length = fill_line_buffer(line_buffers[sending ^ 1]);
+  }
+
+  void ST7789::finish_transfer() {
+    // the DMA finishes as the last pixels go into the FIFO, wait for them to come out
+    if(spi) {
+      while(spi_is_busy(spi))
+        ;
+      // throw away what was received while sending, as spi_write_blocking does
+      while(spi_is_readable(spi))
+        (void)spi_get_hw(spi)->dr;
+      spi_get_hw(spi)->icr = SPI_SSPICR_RORIC_BITS;
+      spi_set_format(spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    } else {
+      uint32_t sm_stall_mask = 1u << (parallel_sm + PIO_FDEBUG_TXSTALL_LSB);
+      parallel_pio->fdebug = sm_stall_mask;
+      while (!(parallel_pio->fdebug & sm_stall_mask))
+        ;
+    }
+
+    gpio_put(cs, 1);
+
+    transfer_graphics = nullptr;
+    busy = false;
+
+    if(update_callback) update_callback();
+  }
+
+  void ST7789::partial_update(PicoGraphics *graphics, Rect region) {
+    region = region.intersection(graphics->bounds);
+    if(region.empty()) return;
+
+    // the region only maps onto the panel when the framebuffer isn't scaled
+    if(graphics->bounds.w != width || graphics->bounds.h != height) {
+      update(graphics);
+      return;
+    }
+
+    if(pio_serial) {
+      // every PIO serial transfer sets its own window in the same DMA chain
+      start_transfer(graphics, region, 1);
+      wait_for_update();
+      return;
+    }
+
+    // shrink the window to the region, caset and raset hold the (byte
+    // swapped) window for the whole panel
+    uint16_t cols[2] = {
+      __builtin_bswap16(uint16_t(__builtin_bswap16(caset[0]) + region.x)),
+      __builtin_bswap16(uint16_t(__builtin_bswap16(caset[0]) + region.x + region.w - 1))
+    };
+    uint16_t rows[2] = {
+      __builtin_bswap16(uint16_t(__builtin_bswap16(raset[0]) + region.y)),
+      __builtin_bswap16(uint16_t(__builtin_bswap16(raset[0]) + region.y + region.h - 1))
+    };
+    command(reg::CASET, 4, (char *)cols);
+    command(reg::RASET, 4, (char *)rows);
+
+    // only the rows and columns inside the region are converted and sent
+    start_transfer(graphics, region, 1);
+    wait_for_update();
+
+    // restore the full window for update()
+    command(reg::CASET, 4, (char *)caset);
+    command(reg::RASET, 4, (char *)raset);
   }
 
   void ST7789::set_backlight(uint8_t brightness) {
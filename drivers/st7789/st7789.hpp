@@ -5,12 +5,15 @@
 #include "hardware/gpio.h"
 #include "hardware/pio.h"
 #include "hardware/pwm.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
 #include "common/pimoroni_common.hpp"
 #include "common/pimoroni_bus.hpp"
 #include "libraries/pico_graphics/pico_graphics.hpp"
 
 
 #include "st7789_parallel.pio.h"
+#include "st7789_serial.pio.h"
 
 #include <algorithm>
 
@@ -23,6 +26,15 @@ namespace pimoroni {
   public:
     bool round;
 
+    // A DMA control block, written to a channel's CTRL, READ_ADDR,
+    // WRITE_ADDR and TRANS_COUNT_TRIG (alias 1) registers by a second channel
+    struct ControlBlock {
+      uint32_t ctrl;
+      const volatile void *read_addr;
+      volatile void *write_addr;
+      uint32_t transfer_count;
+    };
+
     //--------------------------------------------------
     // Variables
     //--------------------------------------------------
@@ -39,7 +51,53 @@ namespace pimoroni {
     uint parallel_sm;
     PIO parallel_pio;
     uint parallel_offset;
-    uint parallel_dma;
+    uint dma_channel;
+
+    // Serial displays driven by PIO send DC with the data, so the window,
+    // RAMWR and pixels of an update are queued as one chain of DMA control
+    // blocks fed to dma_channel by control_channel.
+    bool pio_serial = false;
+    uint control_channel;
+    uint32_t ctrl_words;       // 32-bit transfers, chained
+    uint32_t ctrl_pixels;      // 16-bit byte swapped transfers, chained
+    uint32_t ctrl_pixels_last; // 16-bit byte swapped transfers, interrupt at the end
+    static const uint PREAMBLE_WORDS = 13;
+    uint32_t preamble[PREAMBLE_WORDS];
+    ControlBlock control_blocks[2];
+    ControlBlock *chain = nullptr;
+
+    // Updates are sent by DMA from two line buffers, converting the next
+    // few lines into one while the other is being sent. Each holds four
+    // lines of the widest panel. A PIO serial update straight from an
+    // RGB565 framebuffer uses the same memory for a control block per row.
+    static const uint BUFFER_PIXELS = 320 * 4;
+    union {
+      uint16_t line_buffers[2][BUFFER_PIXELS];
+      ControlBlock row_blocks[sizeof(uint16_t) * 2 * BUFFER_PIXELS / sizeof(ControlBlock)];
+    };
+    size_t pending_length = 0;   // bytes waiting in the buffer not being sent
+    uint sending = 0;            // the line buffer being sent
+
+    volatile bool busy = false;
+    PicoGraphics *transfer_graphics = nullptr;
+    Rect transfer_region;
+    uint transfer_scale = 1;
+    uint transfer_line = 0;      // next line of the panel to fill
+    uint16_t *fill_pointer = nullptr;
+    uint fill_line = 0;          // line of the panel at fill_pointer
+    uint fill_end = 0;           // line after the last one going in the buffer
+
+    // With vsync enabled a transfer is held back until the panel's tear
+    // effect (TE) output rises at the start of vertical blanking, then the
+    // first buffer is sent from the GPIO interrupt.
+    volatile bool waiting_for_vsync = false;
+    const void *first_src = nullptr;
+    size_t first_length = 0;
+    volatile uint32_t vsync_count = 0;       // TE edges seen
+    uint32_t last_frame_vsync = 0;           // the edge the last frame started on
+    bool frame_started = false;
+    uint frame_interval = 1;                 // vsyncs per frame
+    volatile uint32_t missed_vsyncs = 0;
 
 
     // The ST7789 requires 16 ns between SPI rising edges.
@@ -88,12 +146,13 @@ namespace pimoroni {
       pio_sm_set_enabled(parallel_pio, parallel_sm, true);
 
 
-      parallel_dma = dma_claim_unused_channel(true);
-      dma_channel_config config = dma_channel_get_default_config(parallel_dma);
+      dma_channel = dma_claim_unused_channel(true);
+      dma_channel_config config = dma_channel_get_default_config(dma_channel);
       channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
       channel_config_set_bswap(&config, false);
       channel_config_set_dreq(&config, pio_get_dreq(parallel_pio, parallel_sm, true));
-      dma_channel_configure(parallel_dma, &config, &parallel_pio->txf[parallel_sm], NULL, 0, false);
+      dma_channel_configure(dma_channel, &config, &parallel_pio->txf[parallel_sm], NULL, 0, false);
+      init_dma_irq();
   
       gpio_put(rd_sck, 1);
 
@@ -112,18 +171,123 @@ namespace pimoroni {
       gpio_set_function(wr_sck, GPIO_FUNC_SPI);
       gpio_set_function(d0, GPIO_FUNC_SPI);
 
+      // pixel data goes out as 16-bit SPI frames, byte swapped from the
+      // framebuffer's big endian RGB565
+      dma_channel = dma_claim_unused_channel(true);
+      dma_channel_config config = dma_channel_get_default_config(dma_channel);
+      channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+      channel_config_set_bswap(&config, true);
+      channel_config_set_dreq(&config, spi_get_dreq(spi, true));
+      dma_channel_configure(dma_channel, &config, &spi_get_hw(spi)->dr, NULL, 0, false);
+      init_dma_irq();
+
+      common_init();
+    }
+
+    // Serial init, driving the bus from PIO rather than the SPI peripheral
+    // so that the DC changes between commands and data are part of the DMA
+    // stream. Each bit takes two system clocks, so it only goes faster than
+    // the SPI peripheral's 62.5MHz when the system clock is raised.
+    ST7789(uint16_t width, uint16_t height, Rotation rotation, bool round, SPIPins pins, PIO pio, uint32_t baud = SPI_BAUD) :
+      DisplayDriver(width, height, rotation),
+      spi(nullptr), round(round),
+      cs(pins.cs), dc(pins.dc), wr_sck(pins.sck), d0(pins.mosi), bl(pins.bl) {
+
+      pio_serial = true;
+      parallel_pio = pio;
+      parallel_sm = pio_claim_unused_sm(parallel_pio, true);
+      parallel_offset = pio_add_program(parallel_pio, &st7789_serial_program);
+
+      pio_gpio_init(parallel_pio, wr_sck);
+      pio_gpio_init(parallel_pio, d0);
+      pio_gpio_init(parallel_pio, dc);
+      pio_sm_set_consecutive_pindirs(parallel_pio, parallel_sm, wr_sck, 1, true);
+      pio_sm_set_consecutive_pindirs(parallel_pio, parallel_sm, d0, 1, true);
+      pio_sm_set_consecutive_pindirs(parallel_pio, parallel_sm, dc, 1, true);
+
+      pio_sm_config c = st7789_serial_program_get_default_config(parallel_offset);
+
+      sm_config_set_out_pins(&c, d0, 1);
+      sm_config_set_set_pins(&c, dc, 1);
+      sm_config_set_sideset_pins(&c, wr_sck);
+      sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+      sm_config_set_out_shift(&c, false, true, 16);
+      // two instructions per bit, with a whole divider so every bit is the same length
+      uint32_t divider = (clock_get_hz(clk_sys) + 2 * baud - 1) / (2 * baud);
+      sm_config_set_clkdiv_int_frac(&c, std::max(divider, 1u), 0);
+
+      pio_sm_init(parallel_pio, parallel_sm, parallel_offset, &c);
+      pio_sm_set_enabled(parallel_pio, parallel_sm, true);
+
+      dma_channel = dma_claim_unused_channel(true);
+      control_channel = dma_claim_unused_channel(true);
+
+      dma_channel_config config = dma_channel_get_default_config(dma_channel);
+      channel_config_set_dreq(&config, pio_get_dreq(parallel_pio, parallel_sm, true));
+      channel_config_set_chain_to(&config, control_channel);
+      channel_config_set_irq_quiet(&config, true);
+      channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+      ctrl_words = channel_config_get_ctrl_value(&config);
+      // pixels are read a halfword at a time, swapped so that they go out in memory order
+      channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+      channel_config_set_bswap(&config, true);
+      ctrl_pixels = channel_config_get_ctrl_value(&config);
+      // chaining a channel to itself turns chaining off
+      channel_config_set_chain_to(&config, dma_channel);
+      channel_config_set_irq_quiet(&config, false);
+      ctrl_pixels_last = channel_config_get_ctrl_value(&config);
+      dma_channel_configure(dma_channel, &config, &parallel_pio->txf[parallel_sm], NULL, 0, false);
+
+      // each control block goes into the four alias 1 registers, the last triggering the transfer
+      config = dma_channel_get_default_config(control_channel);
+      channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+      channel_config_set_read_increment(&config, true);
+      channel_config_set_write_increment(&config, true);
+      channel_config_set_ring(&config, true, 4);
+      dma_channel_configure(control_channel, &config, &dma_hw->ch[dma_channel].al1_ctrl, NULL, 4, false);
+
+      init_dma_irq();
+
       common_init();
     }
 
     void cleanup() override;
     void update(PicoGraphics *graphics) override;
+    void update_async(PicoGraphics *graphics) override;
+    void partial_update(PicoGraphics *graphics, Rect region) override;
     void set_backlight(uint8_t brightness) override;
+    bool is_busy() override;
+    void wait_for_update();
+
+    // Starts every update on a rising edge of the panel's TE output, wired
+    // to `pin`, so it isn't drawn while the panel is halfway through a
+    // refresh. Updates go out every `interval` vsyncs at most, a frame that
+    // isn't ready in time waits for the next edge and counts the ones it
+    // missed. Pass PIN_UNUSED to go back to starting updates immediately.
+    void set_vsync(uint pin, uint interval = 1);
+    // blocks until the next TE edge
+    void wait_for_vsync();
+    // vsyncs that passed beyond the frame interval while a frame wasn't
+    // ready to go, since the last call
+    uint32_t get_missed_vsyncs();
 
   private:
     void common_init();
+    void start_transfer(PicoGraphics *graphics, const Rect &region, uint scale);
+    size_t fill_line_buffer(uint16_t *buffer);
+    void init_dma_irq();
+    void start_first_dma(const void *src, size_t len);
+    void launch_first_dma();
+    uint build_preamble(const Rect &window, size_t pixel_bytes);
+    void start_dma(const void *src, size_t len);
+    void dma_complete();
+    void finish_transfer();
+    static void dma_irq_handler();
+    void vsync_edge();
+    static void vsync_irq_handler();
     void configure_display(Rotation rotate);
-    void write_blocking_parallel_dma(const uint8_t *src, size_t len);
     void write_blocking_parallel(const uint8_t *src, size_t len);
+    void write_blocking_serial(bool data, const uint8_t *src, size_t len);
     void command(uint8_t command, size_t len = 0, const char *data = NULL);
   };
 
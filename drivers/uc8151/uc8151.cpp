@@ -2,6 +2,11 @@
 
 #include <cstdlib>
 #include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include "hardware/sync.h"
+#include "hardware/structs/iobank0.h"
 
 namespace pimoroni {
 
@@ -49,10 +54,52 @@ namespace pimoroni {
   };
 
   bool UC8151::is_busy() {
+#ifdef MICROPY_BUILD_TYPE
+    // MicroPython keeps the GPIO interrupt to itself, so the rising edges
+    // latched by the pin are picked up here rather than by a handler. The
+    // interrupt is never enabled, so they're read from the raw INTR register
+    // (gpio_get_irq_event_mask only sees enabled ones)
+    uint32_t events = io_bank0_hw->intr[BUSY / 8] >> (4 * (BUSY % 8));
+    if(update_state != IDLE && (events & GPIO_IRQ_EDGE_RISE)) {
+      gpio_acknowledge_irq(BUSY, GPIO_IRQ_EDGE_RISE);
+      busy_edge();
+    }
+#endif
+    if(update_state != IDLE) return true;
     if(BUSY == PIN_UNUSED) return false;
     return !gpio_get(BUSY);
   }
 
+  // displays with their BUSY output wired up, by pin
+  static UC8151 *busy_displays[NUM_BANK0_GPIOS];
+
+  void UC8151::busy_irq_handler() {
+    for(auto pin = 0u; pin < NUM_BANK0_GPIOS; pin++) {
+      if(busy_displays[pin] && (gpio_get_irq_event_mask(pin) & GPIO_IRQ_EDGE_RISE)) {
+        gpio_acknowledge_irq(pin, GPIO_IRQ_EDGE_RISE);
+        busy_displays[pin]->busy_edge();
+      }
+    }
+  }
+
+  void UC8151::busy_edge() {
+    // BUSY goes high when the panel finishes whatever it was doing, and
+    // nothing else talks to the panel until the update is back to IDLE
+    switch(update_state) {
+      case POWERING_ON:
+        update_state = REFRESHING;
+        command(DRF); // start display refresh
+        break;
+      case REFRESHING:
+        command(POF); // turn off
+        update_state = IDLE;
+        if(update_callback) update_callback();
+        break;
+      default:
+        break;
+    }
+  }
+
   void UC8151::busy_wait() {
     while(is_busy()) {
       tight_loop_contents();
@@ -319,10 +366,31 @@ namespace pimoroni {
     gpio_set_function(SCK,  GPIO_FUNC_SPI);
     gpio_set_function(MOSI, GPIO_FUNC_SPI);
 
+#ifndef MICROPY_BUILD_TYPE
+    if(BUSY != PIN_UNUSED) {
+      busy_displays[BUSY] = this;
+      gpio_add_raw_irq_handler(BUSY, busy_irq_handler);
+      gpio_set_irq_enabled(BUSY, GPIO_IRQ_EDGE_RISE, true);
+      irq_set_enabled(IO_IRQ_BANK0, true);
+    }
+#endif
+
     setup();
   };
 
+  void UC8151::cleanup() {
+    busy_wait();
+#ifndef MICROPY_BUILD_TYPE
+    if(BUSY != PIN_UNUSED) {
+      gpio_set_irq_enabled(BUSY, GPIO_IRQ_EDGE_RISE, false);
+      gpio_remove_raw_irq_handler(BUSY, busy_irq_handler);
+      busy_displays[BUSY] = nullptr;
+    }
+#endif
+  }
+
   void UC8151::setup(uint8_t speed) {
+    busy_wait();
     reset();
 
     update_speed = speed;
@@ -391,6 +459,7 @@ namespace pimoroni {
   }
 
   void UC8151::power_off() {
+    busy_wait();
     command(POF);
   }
 
@@ -470,15 +539,40 @@ namespace pimoroni {
     }
   }
 
+  void UC8151::start_refresh() {
+    if(BUSY == PIN_UNUSED) {
+      // nothing to wait on, so the panel is left to get on with it
+      command(DRF); // start display refresh
+      command(POF); // turn off
+      if(update_callback) update_callback();
+      return;
+    }
+
+    // the refresh can't start until power on has finished, and the rising
+    // edge that says so may already have been and gone
+    uint32_t status = save_and_disable_interrupts();
+    gpio_acknowledge_irq(BUSY, GPIO_IRQ_EDGE_RISE);
+    if(gpio_get(BUSY)) {
+      update_state = REFRESHING;
+      command(DRF); // start display refresh
+    } else {
+      update_state = POWERING_ON;
+    }
+    restore_interrupts(status);
+  }
+
   void UC8151::partial_update(PicoGraphics *graphics, Rect region) {
+    partial_update_async(graphics, region);
+    busy_wait();
+  }
+
+  void UC8151::partial_update_async(PicoGraphics *graphics, Rect region) {
     // region.y is given in columns ("banks"), which are groups of 8 horiontal pixels
     // region.x is given in pixels
 
     uint8_t *fb = (uint8_t *)graphics->frame_buffer;
 
-    if(blocking) {
-      busy_wait();
-    }
+    busy_wait();
 
     int cols = region.h / 8;
     int y1 = region.y / 8;
@@ -500,6 +594,8 @@ namespace pimoroni {
     command(PTIN); // enable partial mode
     command(PTL, sizeof(partial_window), partial_window);
 
+    count_partial(region);
+
     command(DTM2);
     for (auto dx = 0; dx < rows; dx++) {
       int sx = dx + x1;
@@ -508,21 +604,19 @@ namespace pimoroni {
     }
     command(DSP); // data stop
 
-    command(DRF); // start display refresh
-
-    if(blocking) {
-      busy_wait();
-
-      command(POF); // turn off
-    }
+    // the refresh and power off follow from the BUSY interrupt
+    start_refresh();
   }
 
   void UC8151::update(PicoGraphics *graphics) {
+    update_async(graphics);
+    busy_wait();
+  }
+
+  void UC8151::update_async(PicoGraphics *graphics) {
     uint8_t *fb = (uint8_t *)graphics->frame_buffer;
 
-    if(blocking) {
-      busy_wait();
-    }
+    busy_wait();
 
     command(PON); // turn on
 
@@ -531,13 +625,78 @@ namespace pimoroni {
     command(DTM2, (width * height) / 8, fb); // transmit framebuffer
     command(DSP); // data stop
 
-    command(DRF); // start display refresh
+    // a full refresh clears any ghosting
+    memset(partial_counts, 0, sizeof(partial_counts));
+
+    // the refresh and power off follow from the BUSY interrupt
+    start_refresh();
+  }
 
-    if(blocking) {
-      busy_wait();
+  static Rect bounding(const Rect &a, const Rect &b) {
+    return Rect(
+      Point(std::min(a.x, b.x), std::min(a.y, b.y)),
+      Point(std::max(a.x + a.w, b.x + b.w), std::max(a.y + a.h, b.y + b.h))
+    );
+  }
 
-      command(POF); // turn off
+  Rect UC8151::align_region(const Rect &region) {
+    // partial windows start and end on whole columns ("banks") of 8 pixels
+    Rect r = region.intersection(Rect(0, 0, width, height));
+    if(r.empty()) return r;
+    int32_t y2 = (r.y + r.h + 7) & ~7;
+    r.y &= ~7;
+    r.h = y2 - r.y;
+    return r;
+  }
+
+  void UC8151::queue_update(Rect region) {
+    Rect r = align_region(region);
+    if(r.empty()) return;
+
+    queued_window = queued_count == 0 ? r : bounding(queued_window, r);
+    queued_count++;
+  }
+
+  void UC8151::update_queued(PicoGraphics *graphics) {
+    if(queued_count == 0) return;
+
+    Rect window = queued_window;
+    queued_count = 0;
+
+    // a window covering most of the panel takes about as long as a full
+    // refresh, which also clears ghosting
+    bool full = window.w * window.h * 100 >= full_update_area * width * height;
+    if(max_partial_updates > 0 && max_partial_count(window) >= max_partial_updates) {
+      full = true;
+    }
+
+    if(full) {
+      update_async(graphics);
+    } else {
+      partial_update_async(graphics, window);
+    }
+  }
+
+  void UC8151::count_partial(const Rect &region) {
+    Rect r = region.intersection(Rect(0, 0, width, height));
+    if(r.empty()) return;
+    for(auto y = r.y * GHOST_ROWS / height; y <= (r.y + r.h - 1) * GHOST_ROWS / height; y++) {
+      for(auto x = r.x * GHOST_COLS / width; x <= (r.x + r.w - 1) * GHOST_COLS / width; x++) {
+        if(partial_counts[y][x] < UINT8_MAX) partial_counts[y][x]++;
+      }
+    }
+  }
+
+  uint8_t UC8151::max_partial_count(const Rect &region) {
+    uint8_t count = 0;
+    Rect r = region.intersection(Rect(0, 0, width, height));
+    if(r.empty()) return count;
+    for(auto y = r.y * GHOST_ROWS / height; y <= (r.y + r.h - 1) * GHOST_ROWS / height; y++) {
+      for(auto x = r.x * GHOST_COLS / width; x <= (r.x + r.w - 1) * GHOST_COLS / width; x++) {
+        count = std::max(count, partial_counts[y][x]);
+      }
     }
+    return count;
   }
 
   void UC8151::off() {
@@ -139,9 +139,34 @@ namespace pimoroni {
 
     uint8_t update_speed = 0;
     bool inverted = true; // Makes 0 black and 1 white, as is foretold.
-    bool blocking = true;
+
+    // where an update is up to, moved along by the BUSY pin's rising edge
+    enum UpdateState {
+      IDLE,        // nothing in progress, though BUSY may still be low for power off
+      POWERING_ON, // waiting for power on before starting the refresh
+      REFRESHING   // waiting for the refresh to finish before powering off
+    };
+    volatile UpdateState update_state = IDLE;
+
+    // the bounding box of the regions waiting for update_queued, which all
+    // go in the controller's one partial window anyway
+    Rect queued_window;
+    uint queued_count = 0;
+
+    // partial refreshes since the last full one, counted over a coarse grid
+    static const uint GHOST_COLS = 16;
+    static const uint GHOST_ROWS = 8;
+    uint8_t partial_counts[GHOST_ROWS][GHOST_COLS] = {};
 
   public:
+    // update_queued does a full refresh instead of a partial one when the
+    // window would cover at least this percentage of the panel...
+    uint8_t full_update_area = 60;
+    // ...or when part of it has already had this many partial refreshes
+    // (0 for no limit), to clear the ghosting they leave behind
+    uint8_t max_partial_updates = 8;
+
+
     UC8151(uint16_t width, uint16_t height, Rotation rotate) : UC8151(width, height, rotate, {PIMORONI_SPI_DEFAULT_INSTANCE, SPI_BG_FRONT_CS, SPI_DEFAULT_SCK, SPI_DEFAULT_MOSI, PIN_UNUSED, 20, PIN_UNUSED}) {};
 
     UC8151(uint16_t width, uint16_t height, Rotation rotate, SPIPins pins, uint busy=26, uint reset=21) :
@@ -162,7 +187,10 @@ namespace pimoroni {
     // DisplayDriver API
     bool is_busy() override;
     void update(PicoGraphics *graphics) override;
+    void update_async(PicoGraphics *graphics) override;
     void partial_update(PicoGraphics *graphics, Rect region) override;
+    void partial_update_async(PicoGraphics *graphics, Rect region) override;
+    void cleanup() override;
   
     // UC8151 Specific
     void default_luts();
@@ -170,6 +198,14 @@ namespace pimoroni {
     void fast_luts();
     void turbo_luts();
 
+    // Queued regions are merged and sent as one refresh by update_queued.
+    // The controller only has one partial window, and refreshing it takes
+    // the same time however small it is, so many small updates are much
+    // quicker sent together.
+    void queue_update(Rect region) override;
+    void update_queued(PicoGraphics *graphics) override;
+    uint get_queued_count() {return queued_count;};
+
     void set_update_speed(uint8_t speed);
     uint8_t get_update_speed();
     uint32_t update_time();
@@ -184,8 +220,13 @@ namespace pimoroni {
     void command(uint8_t reg) {command(reg, 0, nullptr);};
     void data(size_t len, const uint8_t *data);
 
-    void update(bool blocking = true);
-    void partial_update(int x, int y, int w, int h, bool blocking = true);
+    Rect align_region(const Rect &region);
+    void count_partial(const Rect &region);
+    uint8_t max_partial_count(const Rect &region);
+
+    void start_refresh();
+    static void busy_irq_handler();
+    void busy_edge();
     void off();
   };
 
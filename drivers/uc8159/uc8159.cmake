@@ -7,4 +7,4 @@ target_sources(${DRIVER_NAME} INTERFACE
 target_include_directories(${DRIVER_NAME} INTERFACE ${CMAKE_CURRENT_LIST_DIR})
 
 # Pull in pico libraries that we need
-target_link_libraries(${DRIVER_NAME} INTERFACE pico_stdlib hardware_spi)
+target_link_libraries(${DRIVER_NAME} INTERFACE pico_stdlib hardware_spi hardware_dma)
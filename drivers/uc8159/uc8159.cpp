@@ -3,6 +3,9 @@
 #include <cstdlib>
 #include <math.h>
 #include <string.h>
+#include <algorithm>
+
+#include "hardware/dma.h"
 
 namespace pimoroni {
 
@@ -38,7 +41,30 @@ namespace pimoroni {
   };
 
   bool UC8159::is_busy() {
-    return !gpio_get(BUSY);
+    switch(update_state) {
+      case SENDING:
+        if(dma_channel_is_busy(dma_channel) || spi_is_busy(spi)) return true;
+        finish_dma();
+        update_state = SENT;
+        return true;
+      case SENT:
+        if(!gpio_get(BUSY)) return true;
+        command(PON); // turn on
+        update_state = POWERING_ON;
+        return true;
+      case POWERING_ON:
+        if(!gpio_get(BUSY)) return true;
+        command(DRF); // start display refresh
+        update_state = REFRESHING;
+        return true;
+      case REFRESHING:
+        if(!gpio_get(BUSY)) return true;
+        update_state = IDLE;
+        if(update_callback) update_callback();
+        return false;
+      default:
+        return !gpio_get(BUSY);
+    }
   }
 
   void UC8159::busy_wait() {
@@ -54,8 +80,9 @@ namespace pimoroni {
   }
 
   void UC8159::init() {
-    // configure spi interface and pins
-    spi_init(spi, 3'000'000);
+    // configure spi interface and pins, spi_init gives back the clock it
+    // actually managed
+    spi_baud = spi_init(spi, spi_baud < MAX_SPI_BAUD ? spi_baud : MAX_SPI_BAUD);
 
     gpio_set_function(DC, GPIO_FUNC_SIO);
     gpio_set_dir(DC, GPIO_OUT);
@@ -74,8 +101,26 @@ namespace pimoroni {
 
     gpio_set_function(SCK,  GPIO_FUNC_SPI);
     gpio_set_function(MOSI, GPIO_FUNC_SPI);
+
+    // pixel data goes out by DMA, a byte at a time
+    dma_channel = dma_claim_unused_channel(true);
+    dma_channel_config config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+    channel_config_set_dreq(&config, spi_get_dreq(spi, true));
+    dma_channel_configure(dma_channel, &config, &spi_get_hw(spi)->dr, NULL, 0, false);
   };
 
+  void UC8159::cleanup() {
+    if(dma_channel_is_claimed(dma_channel)) {
+      dma_channel_abort(dma_channel);
+      dma_channel_unclaim(dma_channel);
+    }
+    if(update_state == SENDING) {
+      gpio_put(CS, 1);
+    }
+    update_state = IDLE;
+  }
+
   void UC8159::setup() {
     reset();
     busy_wait();
@@ -126,14 +171,27 @@ namespace pimoroni {
     command(reg, values.size(), (uint8_t *)values.begin());
   }
 
-  void UC8159::update(const void *data, bool blocking) {
-    if(blocking) {
-      busy_wait();
-    }
+  void UC8159::start_dma(const uint8_t *data, size_t len) {
+    gpio_put(CS, 0);
+    gpio_put(DC, 1); // data mode
+    dma_channel_set_trans_count(dma_channel, len, false);
+    dma_channel_set_read_addr(dma_channel, data, true);
+  }
 
-    setup();
+  void UC8159::finish_dma() {
+    dma_channel_wait_for_finish_blocking(dma_channel);
+    while(spi_is_busy(spi))
+      ;
 
-    command(DTM1, (width * height) / 2, (uint8_t *)data); // transmit framebuffer
+    // throw away what was received while sending, as spi_write_blocking does
+    while(spi_is_readable(spi))
+      (void)spi_get_hw(spi)->dr;
+    spi_get_hw(spi)->icr = SPI_SSPICR_RORIC_BITS;
+
+    gpio_put(CS, 1);
+  }
+
+  void UC8159::refresh() {
     busy_wait();
 
     command(PON); // turn on
@@ -141,17 +199,62 @@ namespace pimoroni {
 
     command(DRF); // start display refresh
     busy_wait();
-
-    if(blocking) {
-      busy_wait();
-
-      command(POF); // turn off
-    }
   }
 
   void UC8159::update(PicoGraphics *graphics) {
+    update_async(graphics);
+    busy_wait();
+  }
+
+  // Returns as soon as the framebuffer is on its way by DMA, is_busy then
+  // powers on and starts the refresh once it has all gone
+  void UC8159::update_async(PicoGraphics *graphics) {
     if(graphics->pen_type != PicoGraphics::PEN_P4) return; // Incompatible buffer
-    update(graphics->frame_buffer, false);
+
+    busy_wait();
+
+    setup();
+
+    command(DTM1); // transmit framebuffer
+    start_dma((const uint8_t *)graphics->frame_buffer, (width * height) / 2);
+    update_state = SENDING;
+  }
+
+  void UC8159::update(uint8_t *band, uint band_rows, band_callback_func callback) {
+    if(band_rows == 0) return;
+
+    busy_wait();
+
+    setup();
+
+    // the controller keeps writing pixels on from where the last data left
+    // off until the next command, so each band follows straight on
+    command(DTM1);
+
+    uint row_bytes = width / 2;
+    uint half_rows = std::max(band_rows / 2, 1u);
+    uint8_t *halves[2] = {band, band + (band_rows > 1 ? half_rows * row_bytes : 0)};
+    uint half = 0;
+    bool sending = false;
+
+    for(auto y = 0u; y < height; y += half_rows) {
+      uint rows = std::min(half_rows, height - y);
+      // with a single row there's only one buffer, so it has to be sent
+      // before it can be filled again
+      if(sending && band_rows == 1) {
+        finish_dma();
+        sending = false;
+      }
+      callback(halves[half], y, rows);
+      // the other half must be out of the way before this one is sent
+      if(sending) finish_dma();
+      start_dma(halves[half], rows * row_bytes);
+      sending = true;
+      half ^= 1;
+    }
+    finish_dma();
+
+    refresh();
   }
 
 }
@@ -32,7 +32,26 @@ namespace pimoroni {
     uint BUSY   = 26;
     uint RESET  = 25;
 
+    uint32_t spi_baud;
+    uint dma_channel;
+
+    // where an update is up to, moved along by is_busy
+    enum UpdateState {
+      IDLE,
+      SENDING,     // framebuffer going out by DMA
+      SENT,        // waiting for the controller to take it all in
+      POWERING_ON, // waiting for power on before starting the refresh
+      REFRESHING
+    };
+    UpdateState update_state = IDLE;
+
   public:
+    // 3MHz is known to work on Inky Frame. The controller's serial writes
+    // are specified up to 20MHz, so a faster clock can be asked for in the
+    // constructor, but check it on the panel you have
+    static const uint32_t SPI_BAUD = 3'000'000;
+    static const uint32_t MAX_SPI_BAUD = 20'000'000;
+
     enum colour : uint8_t {
       BLACK = 0,
       WHITE = 1,
@@ -44,12 +63,16 @@ namespace pimoroni {
       CLEAN = 7
     };
 
+    // Fills band with rows y to y + rows - 1 of the image, two pixels a
+    // byte (left hand pixel in the high nibble) and width / 2 bytes a row
+    typedef std::function<void(uint8_t *band, uint y, uint rows)> band_callback_func;
+
     UC8159(uint16_t width, uint16_t height) : UC8159(width, height, {PIMORONI_SPI_DEFAULT_INSTANCE, SPI_BG_FRONT_CS, SPI_DEFAULT_SCK, SPI_DEFAULT_MOSI, PIN_UNUSED, 27, PIN_UNUSED}) {};
 
-    UC8159(uint16_t width, uint16_t height, SPIPins pins, uint busy=26, uint reset=25) :
+    UC8159(uint16_t width, uint16_t height, SPIPins pins, uint busy=26, uint reset=25, uint32_t baud=SPI_BAUD) :
       DisplayDriver(width, height, ROTATE_0),
       spi(pins.spi),
-      CS(pins.cs), DC(pins.dc), SCK(pins.sck), MOSI(pins.mosi), BUSY(busy), RESET(reset) {
+      CS(pins.cs), DC(pins.dc), SCK(pins.sck), MOSI(pins.mosi), BUSY(busy), RESET(reset), spi_baud(baud) {
         init();
       }
 
@@ -62,18 +85,36 @@ namespace pimoroni {
     void reset();
     void power_off();
   
+    // NOTE: is_busy also moves an update from update_async on to its next
+    // step, so it's what sends the power on (PON) and refresh (DRF)
+    // commands. Keep calling it (or busy_wait) until it returns false,
+    // otherwise the panel is never refreshed
     bool is_busy() override;
     void update(PicoGraphics *graphics) override;
+    void update_async(PicoGraphics *graphics) override;
+    void cleanup() override;
+
+    // Streams the image to the panel a band of rows at a time, as callback
+    // produces them, so no full framebuffer is needed. band must hold
+    // band_rows * width / 2 bytes. It is used in two halves, one filled
+    // while the other is sent, so callback is asked for band_rows / 2 rows
+    // at a time (or one row when band_rows is 1).
+    void update(uint8_t *band, uint band_rows, band_callback_func callback);
+
+    // actual SPI clock, the nearest the hardware can do to the one asked for
+    uint32_t get_spi_baud() {return spi_baud;};
 
   private:
     void init();
     void setup();
-    void update(const void *data, bool blocking = true);
+    void refresh();
     void command(uint8_t reg, size_t len, const uint8_t *data);
     void command(uint8_t reg, std::initializer_list<uint8_t> values);
     void command(uint8_t reg, const uint8_t data) {command(reg, 0, &data);};
     void command(uint8_t reg) {command(reg, 0, nullptr);};
     void data(size_t len, const uint8_t *data);
+    void start_dma(const uint8_t *data, size_t len);
+    void finish_dma();
   };
 
 }
@@ -16,7 +16,7 @@ const int HEIGHT = 128;
 I2C i2c(4, 5);
 
 SH1107 sh1107(WIDTH, HEIGHT, i2c);
-PicoGraphics_Pen1Bit graphics(sh1107.width, sh1107.height, nullptr);
+PicoGraphics_Pen1BitPaged graphics(sh1107.width, sh1107.height, nullptr);
 
 int main() {
 
@@ -0,0 +1,45 @@
+#include "drivers/uc8159/uc8159.hpp"
+
+using namespace pimoroni;
+
+/*
+  Draws a test card on Inky Frame without a framebuffer. The image is worked
+  out a few rows at a time as the driver asks for them, so the whole thing
+  needs an 8 KB band buffer rather than the 134 KB a PicoGraphics_PenP4
+  framebuffer of the panel would take.
+*/
+
+UC8159 uc8159(600, 448);
+
+// the driver fills one half of this while it sends the other, so the
+// callback is asked for 16 rows at a time
+static const uint BAND_ROWS = 32;
+uint8_t band[BAND_ROWS * 600 / 2];
+
+// the colour of a pixel: stripes of every colour, with a black and white
+// chequerboard in a circle in the middle
+uint8_t test_card(int x, int y) {
+    int dx = x - uc8159.width / 2;
+    int dy = y - uc8159.height / 2;
+    if(dx * dx + dy * dy < 150 * 150) {
+        return ((x / 25) + (y / 25)) & 1 ? UC8159::BLACK : UC8159::WHITE;
+    }
+    static const uint8_t stripes[] = {
+        UC8159::BLACK, UC8159::WHITE, UC8159::GREEN, UC8159::BLUE,
+        UC8159::RED, UC8159::YELLOW, UC8159::ORANGE
+    };
+    return stripes[x * count_of(stripes) / uc8159.width];
+}
+
+int main() {
+    uc8159.update(band, BAND_ROWS, [](uint8_t *data, uint y, uint rows) {
+        // two pixels to a byte, the left hand one in the high nibble
+        for(auto row = y; row < y + rows; row++) {
+            for(auto x = 0; x < uc8159.width; x += 2) {
+                *data++ = test_card(x, row) << 4 | test_card(x + 1, row);
+            }
+        }
+    });
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+set(OUTPUT_NAME interstate75_graphics)
+add_executable(${OUTPUT_NAME} interstate75_graphics.cpp)
+
+# enable usb output
+pico_enable_stdio_usb(${OUTPUT_NAME} 1)
+
+pico_add_extra_outputs(${OUTPUT_NAME})
+
+target_link_libraries(${OUTPUT_NAME}
+    pico_stdlib
+    hardware_vreg
+    pico_graphics
+    hub75
+)
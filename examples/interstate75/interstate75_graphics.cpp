@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <math.h>
+#include <cstdint>
+
+#include "pico/stdlib.h"
+#include "hardware/vreg.h"
+
+#include "common/pimoroni_common.hpp"
+#include "libraries/pico_graphics/pico_graphics.hpp"
+#include "hub75.hpp"
+
+using namespace pimoroni;
+
+// Display size in pixels
+// Should be either 64x64 or 32x32 but perhaps 64x32 an other sizes will work.
+// Note: this example uses only 5 address lines so it's limited to 64 pixel high displays (32*2).
+const uint8_t WIDTH = 64;
+const uint8_t HEIGHT = 64;
+
+Hub75 hub75(WIDTH, HEIGHT, nullptr, PANEL_GENERIC, true);
+
+// Draw with PicoGraphics and let hub75.update() gamma correct the whole frame onto the panel.
+// PicoGraphics_PenRGB332 and PicoGraphics_PenP8 use less RAM, but PicoGraphics_PenRGB565 keeps the most colour.
+PicoGraphics_PenRGB565 graphics(hub75.width, hub75.height, nullptr);
+
+void __isr dma_complete() {
+    hub75.dma_complete();
+}
+
+int main() {
+    vreg_set_voltage(VREG_VOLTAGE_1_20);
+    sleep_us(100);
+    set_sys_clock_khz(266000, true);
+
+    hub75.start(dma_complete);
+
+    Pen BLACK = graphics.create_pen(0, 0, 0);
+    Pen WHITE = graphics.create_pen(255, 255, 255);
+
+    while (true) {
+        float t = millis() / 1000.0f;
+
+        graphics.set_pen(BLACK);
+        graphics.clear();
+
+        // A circle bouncing around in colour
+        Point p(
+            WIDTH / 2 + int(sinf(t * 1.3f) * (WIDTH / 2 - 10)),
+            HEIGHT / 2 + int(cosf(t * 0.9f) * (HEIGHT / 2 - 10))
+        );
+        graphics.set_pen(
+            uint8_t(127 + sinf(t) * 127),
+            uint8_t(127 + sinf(t + 2.1f) * 127),
+            uint8_t(127 + sinf(t + 4.2f) * 127));
+        graphics.circle(p, 8);
+
+        graphics.set_pen(WHITE);
+        graphics.text("Hello", Point(2, 2), WIDTH);
+
+        hub75.update(&graphics);
+    }
+}
@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <math.h>
+#include <cstdint>
+
+#include "pico/stdlib.h"
+
+#include "plasma2040.hpp"
+#include "led_matrix.hpp"
+#include "libraries/pico_graphics/pico_graphics.hpp"
+
+#include "common/pimoroni_common.hpp"
+
+/*
+Draws with PicoGraphics on an LED matrix made from a WS2812 strip.
+Set WIDTH, HEIGHT and the layout below to match how your LEDs are wired.
+*/
+
+using namespace pimoroni;
+using namespace plasma;
+
+// Size of the matrix in LEDs
+const uint WIDTH = 16;
+const uint HEIGHT = 16;
+
+// How many times the LEDs will be updated per second
+const uint UPDATES = 60;
+
+WS2812 led_strip(WIDTH * HEIGHT, pio0, 0, plasma2040::DAT);
+
+LEDMatrix matrix(WIDTH, HEIGHT, led_strip);
+PicoGraphics_PenRGB332 graphics(WIDTH, HEIGHT, nullptr);
+
+
+int main() {
+  stdio_init_all();
+
+  // One panel of LEDs wired back and forth along each row
+  matrix.set_layout(WIDTH, HEIGHT, true);
+  // LED matrices are very bright!
+  matrix.set_backlight(64);
+
+  Pen BLACK = graphics.create_pen(0, 0, 0);
+
+  while(true) {
+    float t = millis() / 1000.0f;
+
+    graphics.set_pen(BLACK);
+    graphics.clear();
+
+    for(auto i = 0u; i < 3; i++) {
+      float a = t + i * 2.1f;
+      graphics.set_pen(i == 0 ? 255 : 0, i == 1 ? 255 : 0, i == 2 ? 255 : 0);
+      graphics.circle(Point(WIDTH / 2 + int(sinf(a) * WIDTH / 3), HEIGHT / 2 + int(cosf(a * 1.3f) * HEIGHT / 3)), 3);
+    }
+
+    matrix.update(&graphics);
+
+    sleep_ms(1000 / UPDATES);
+  }
+}
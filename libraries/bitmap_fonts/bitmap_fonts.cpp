@@ -170,4 +170,132 @@ namespace bitmap {
       i = next_space + 1;
     }
   }
-}
\ No newline at end of file
+
+  static const alpha_glyph_t *alpha_glyph(const alpha_font_t *font, uint8_t c) {
+    if(c < font->first || c - font->first >= font->count) {
+      return nullptr;
+    }
+    return &font->glyphs[c - font->first];
+  }
+
+  // kerning pairs are sorted so they can be binary searched
+  static int32_t alpha_kerning(const alpha_font_t *font, const alpha_glyph_t *left, const alpha_glyph_t *right) {
+    uint16_t key = ((left - font->glyphs) << 8) | (right - font->glyphs);
+    int32_t lo = 0, hi = font->kerning_count - 1;
+    while(lo <= hi) {
+      int32_t mid = (lo + hi) / 2;
+      const alpha_kerning_t &k = font->kerning[mid];
+      uint16_t mid_key = (k.left << 8) | k.right;
+      if(mid_key == key) return k.adjust;
+      if(mid_key < key) lo = mid + 1; else hi = mid - 1;
+    }
+    return 0;
+  }
+
+  // decodes the character at t[i] and moves i past it. two byte UTF-8
+  // sequences map onto Latin-1 (U+0080 - U+00FF), anything else that isn't
+  // ASCII is skipped and returns 0
+  static uint8_t alpha_next_char(const std::string &t, size_t &i) {
+    uint8_t c = t[i++];
+    if(c < 0x80) return c;
+    if((c == 0xc2 || c == 0xc3) && i < t.length() && (t[i] & 0xc0) == 0x80) {
+      return ((c & 0x03) << 6) | (t[i++] & 0x3f);
+    }
+    while(i < t.length() && (t[i] & 0xc0) == 0x80) i++;
+    return 0;
+  }
+
+  // width of the characters from t[start] up to t[end] including kerning
+  static int32_t alpha_measure(const alpha_font_t *font, const std::string &t, size_t start, size_t end) {
+    int32_t width = 0;
+    const alpha_glyph_t *last = nullptr;
+    size_t i = start;
+    while(i < end) {
+      const alpha_glyph_t *g = alpha_glyph(font, alpha_next_char(t, i));
+      if(!g) continue;
+      if(last) width += alpha_kerning(font, last, g);
+      width += g->advance;
+      last = g;
+    }
+    return width;
+  }
+
+  int32_t measure_character(const alpha_font_t *font, const char c) {
+    const alpha_glyph_t *g = alpha_glyph(font, c);
+    return g ? g->advance : 0;
+  }
+
+  int32_t measure_text(const alpha_font_t *font, const std::string &t) {
+    return alpha_measure(font, t, 0, t.length());
+  }
+
+  static void alpha_draw_glyph(const alpha_font_t *font, span_func &span, const alpha_glyph_t *g, const int32_t x, const int32_t y) {
+    const uint8_t *d = font->data;
+    int32_t gx = x + g->x_offset;
+    int32_t gy = y + g->y_offset;
+
+    // pixels are split into runs of the same alpha, fully transparent runs
+    // are skipped
+    uint32_t n = g->offset;
+    for(int32_t row = 0; row < g->height; row++) {
+      int32_t run = 0;
+      uint8_t run_alpha = 0;
+      for(int32_t col = 0; col < g->width; col++, n++) {
+        uint8_t a = (n & 1) ? d[n >> 1] & 0x0f : d[n >> 1] >> 4;
+        if(a != run_alpha) {
+          if(run_alpha) span(gx + col - run, gy + row, run, run_alpha * 17);
+          run = 0;
+          run_alpha = a;
+        }
+        run++;
+      }
+      if(run_alpha) span(gx + g->width - run, gy + row, run, run_alpha * 17);
+    }
+  }
+
+  void character(const alpha_font_t *font, span_func span, const char c, const int32_t x, const int32_t y) {
+    const alpha_glyph_t *g = alpha_glyph(font, c);
+    if(g) alpha_draw_glyph(font, span, g, x, y);
+  }
+
+  void text(const alpha_font_t *font, span_func span, const std::string &t, const int32_t x, const int32_t y, const int32_t wrap) {
+    int32_t co = 0, lo = 0; // character and line (if wrapping) offset
+    const alpha_glyph_t *space = alpha_glyph(font, ' ');
+    int32_t space_width = space ? space->advance : font->height / 4;
+
+    size_t i = 0;
+    while(i < t.length()) {
+      // find length of current word
+      size_t next_space = t.find(' ', i + 1);
+
+      if(next_space == std::string::npos) {
+        next_space = t.length();
+      }
+
+      int32_t word_width = alpha_measure(font, t, i, next_space);
+
+      // if this word would exceed the wrap limit then
+      // move to the next line
+      if(co != 0 && co + word_width > wrap) {
+        co = 0;
+        lo += font->height;
+      }
+
+      // draw word
+      const alpha_glyph_t *last = nullptr;
+      size_t j = i;
+      while(j < next_space) {
+        const alpha_glyph_t *g = alpha_glyph(font, alpha_next_char(t, j));
+        if(!g) continue;
+        if(last) co += alpha_kerning(font, last, g);
+        alpha_draw_glyph(font, span, g, x + co, y + lo);
+        co += g->advance;
+        last = g;
+      }
+
+      // move character offset to end of word and add a space
+      co += space_width;
+      i = next_space + 1;
+    }
+  }
+}
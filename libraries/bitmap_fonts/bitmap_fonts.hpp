@@ -23,4 +23,40 @@ namespace bitmap {
 
   void character(const font_t *font, rect_func rectangle, const char c, const int32_t x, const int32_t y, const uint8_t scale = 2, unicode_sorta::codepage_t codepage = unicode_sorta::PAGE_195);
   void text(const font_t *font, rect_func rectangle, const std::string &t, const int32_t x, const int32_t y, const int32_t wrap, const uint8_t scale = 2, const uint8_t letter_spacing = 1);
+
+  // anti-aliased fonts with a 4-bit alpha value per pixel, converted from
+  // TrueType fonts at a fixed size by ttf-to-alpha-font.py
+  struct alpha_glyph_t {
+    uint32_t offset;      // index of the glyph's first pixel in data
+    uint8_t width;        // size of the glyph's pixels
+    uint8_t height;
+    int8_t x_offset;      // top left of the pixels relative to the pen
+    int8_t y_offset;      // position, which is at the top of the line
+    uint8_t advance;      // distance to the next pen position
+  };
+
+  struct alpha_kerning_t {
+    uint8_t left;         // glyph indices, sorted by left then right
+    uint8_t right;
+    int8_t adjust;        // added to the advance of the left glyph
+  };
+
+  struct alpha_font_t {
+    const uint8_t height;           // line height
+    const uint8_t first;            // character code of the first glyph
+    const uint8_t count;            // number of glyphs
+    const uint16_t kerning_count;
+    const alpha_glyph_t *glyphs;
+    const alpha_kerning_t *kerning;
+    const uint8_t *data;            // two pixels per byte, high nibble first, rows not padded
+  };
+
+  // a run of l pixels starting at x, y that all have the same alpha (1-255)
+  typedef std::function<void(int32_t x, int32_t y, int32_t l, uint8_t alpha)> span_func;
+
+  int32_t measure_character(const alpha_font_t *font, const char c);
+  int32_t measure_text(const alpha_font_t *font, const std::string &t);
+
+  void character(const alpha_font_t *font, span_func span, const char c, const int32_t x, const int32_t y);
+  void text(const alpha_font_t *font, span_func span, const std::string &t, const int32_t x, const int32_t y, const int32_t wrap);
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Converts a TrueType or OpenType font into the anti-aliased bitmap font format
+drawn by PicoGraphics (bitmap::alpha_font_t), with 4 bits of alpha per pixel.
+
+Glyphs are rendered at a fixed pixel size, so convert each size you need. The
+characters covered are printable ASCII, and optionally Latin-1. Kerning pairs
+are measured using the font's own layout and only pairs that move a glyph by
+at least a whole pixel are kept.
+
+Outputs a .hpp file containing const arrays that stay in flash when compiled
+into a C++ project. Requires Pillow (pip install pillow).
+"""
+
+import re
+import argparse
+from pathlib import Path
+from PIL import Image, ImageDraw, ImageFont
+
+
+parser = argparse.ArgumentParser(description='Converts TrueType fonts into the anti-aliased bitmap font format used by PicoGraphics.')
+parser.add_argument('file', help='input font file')
+parser.add_argument('--size', type=int, required=True, help='font size in pixels')
+parser.add_argument('--name', default=None, help='name of the font in the output (default is the file name and size)')
+parser.add_argument('--out_dir', type=Path, default=None, help='output directory')
+parser.add_argument('--latin1', action="store_true", help='include Latin-1 characters (U+00A0 to U+00FF) as well as ASCII')
+parser.add_argument('--no-kerning', action="store_true", help='leave out the kerning table')
+
+options = parser.parse_args()
+
+
+def render_glyph(font, c):
+    """Returns (x_offset, y_offset, width, height, 4-bit alpha values) for a character, relative to the top of the line."""
+    x0, y0, x1, y1 = font.getbbox(c, anchor="la")
+    if x1 <= x0 or y1 <= y0:
+        return 0, 0, 0, 0, []
+
+    image = Image.new("L", (x1 - x0, y1 - y0), 0)
+    ImageDraw.Draw(image).text((-x0, -y0), c, font=font, fill=255, anchor="la")
+
+    # trim away any fully transparent edges
+    box = image.getbbox()
+    if box is None:
+        return 0, 0, 0, 0, []
+    image = image.crop(box)
+
+    alpha = [(v * 15 + 127) // 255 for v in image.getdata()]
+    return x0 + box[0], y0 + box[1], image.width, image.height, alpha
+
+
+def convert(font_path):
+    font = ImageFont.truetype(str(font_path), options.size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+
+    last = 255 if options.latin1 else 126
+    chars = [chr(c) for c in range(32, last + 1)]
+
+    glyphs = []
+    data = []
+    for c in chars:
+        # the C1 control characters have no glyph but keep the table contiguous
+        if 127 <= ord(c) < 160:
+            glyphs.append((len(data), 0, 0, 0, 0, 0))
+            continue
+
+        x, y, w, h, alpha = render_glyph(font, c)
+        advance = round(font.getlength(c))
+        if w > 255 or h > 255 or not (-128 <= x <= 127 and -128 <= y <= 127) or advance > 255:
+            raise ValueError(f"glyph {c!r} is too large, try a smaller --size")
+
+        glyphs.append((len(data), w, h, x, y, advance))
+        data += alpha
+
+    kerning = []
+    if not options.no_kerning:
+        printable = [c for c in chars if c != ' ' and not 127 <= ord(c) < 160]
+        lengths = {c: font.getlength(c) for c in printable}
+        for left in printable:
+            for right in printable:
+                # where the layout puts the right glyph compared to where
+                # the rounded advance would
+                adjust = round(font.getlength(left + right) - lengths[right]) - round(lengths[left])
+                if adjust != 0:
+                    kerning.append((chars.index(left), chars.index(right), max(-128, min(127, adjust))))
+
+    # two pixels per byte, high nibble first
+    if len(data) % 2:
+        data.append(0)
+    packed = bytes((data[i] << 4) | data[i + 1] for i in range(0, len(data), 2))
+
+    return height, chars, glyphs, kerning, packed
+
+
+def char_comment(c):
+    return repr(c) if c.isprintable() else f"U+{ord(c):04X}"
+
+
+input_path = Path(options.file)
+height, chars, glyphs, kerning, packed = convert(input_path)
+
+name = options.name or f"{input_path.stem}_{options.size}"
+name = re.sub(r'\W', '_', name).lower()
+
+output_dir = options.out_dir or input_path.parent
+output_path = output_dir / (name + ".hpp")
+
+with open(output_path, "w") as f:
+    f.write("#pragma once\n\n#include \"bitmap_fonts.hpp\"\n\n")
+    f.write(f"// {input_path.name} at {options.size}px converted by ttf-to-alpha-font.py\n\n")
+
+    f.write(f"static const bitmap::alpha_glyph_t {name}_glyphs[{len(glyphs)}] = {{\n")
+    f.write("  // offset, width, height, x_offset, y_offset, advance\n")
+    for c, (offset, w, h, x, y, advance) in zip(chars, glyphs):
+        f.write(f"  {{{offset:6d}, {w:3d}, {h:3d}, {x:4d}, {y:4d}, {advance:3d}}}, // {char_comment(c)}\n")
+    f.write("};\n\n")
+
+    if kerning:
+        f.write(f"static const bitmap::alpha_kerning_t {name}_kerning[{len(kerning)}] = {{\n")
+        for left, right, adjust in kerning:
+            f.write(f"  {{{left:3d}, {right:3d}, {adjust:3d}}}, // {char_comment(chars[left])} {char_comment(chars[right])}\n")
+        f.write("};\n\n")
+
+    f.write(f"static const uint8_t {name}_data[{len(packed)}] = {{\n")
+    for i in range(0, len(packed), 16):
+        f.write("  " + ", ".join(f"0x{b:02x}" for b in packed[i:i + 16]) + ",\n")
+    f.write("};\n\n")
+
+    # positional, designated initializers need C++20
+    f.write(f"const bitmap::alpha_font_t {name} {{\n")
+    f.write(f"  {height}, // height\n")
+    f.write(f"  {ord(chars[0])}, // first\n")
+    f.write(f"  {len(chars)}, // count\n")
+    f.write(f"  {len(kerning)}, // kerning_count\n")
+    f.write(f"  {name}_glyphs,\n")
+    f.write(f"  {name + '_kerning' if kerning else 'nullptr'},\n")
+    f.write(f"  {name}_data\n")
+    f.write("};\n")
+
+glyph_bytes = len(glyphs) * 12 + len(kerning) * 3 + len(packed)
+print(f"Converted: {input_path} {options.size}px, {len(glyphs)} glyphs, {len(kerning)} kerning pairs, about {glyph_bytes} bytes")
+print(f"Written to: {output_path}")
@@ -0,0 +1,247 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "libraries/pico_graphics/pico_graphics.hpp"
+
+#include "pens.hpp"
+
+using namespace pimoroni;
+
+/*
+  Measures how quickly each primitive draws for every pen type at a range of
+  common display resolutions.
+
+  Usage: pico_graphics_benchmark [--duration ms] [--csv] [filter ...]
+
+  Filters are matched against "pen/resolution/primitive", eg: "RGB565/" or
+  "240x240/circle". Each benchmark runs for at least --duration milliseconds
+  (default 100) and reports calls per second and pixels per second, where the
+  pixel count comes from replaying the same calls into a counting pen.
+*/
+
+struct Resolution {
+  uint16_t w, h;
+};
+
+static const Resolution resolutions[] = {
+  {128, 128},   // SH1107 OLED
+  {160,  80},   // ST7735 0.96" LCD
+  {240, 135},   // Pico Display
+  {240, 240},   // 1.3" and 1.54" square LCDs
+  {296, 128},   // Badger 2040
+  {320, 240},   // Pico Display 2.0, Tufty 2040
+  {600, 448},   // Inky Frame
+};
+
+// every benchmark cycles through the same pseudo-random set of shapes so
+// that the results are repeatable
+static const uint SHAPE_COUNT = 64;
+
+struct Shape {
+  Point p[6];
+  int32_t r;
+  Rect rect;
+};
+
+static uint32_t rng_state;
+
+static int32_t rng(int32_t max) {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return max > 0 ? int32_t((rng_state >> 8) % uint32_t(max)) : 0;
+}
+
+static std::vector<Shape> make_shapes(const Rect &bounds) {
+  rng_state = 0x1234;
+  std::vector<Shape> shapes(SHAPE_COUNT);
+  for(auto &s : shapes) {
+    for(auto &p : s.p) {
+      p = Point(rng(bounds.w), rng(bounds.h));
+    }
+    s.r = 1 + rng(std::min(bounds.w, bounds.h) / 8);
+    s.rect = Rect(rng(bounds.w), rng(bounds.h), 1 + rng(bounds.w / 4), 1 + rng(bounds.h / 4));
+  }
+  return shapes;
+}
+
+struct Primitive {
+  const char *name;
+  void (*draw)(PicoGraphics &g, const Shape &s);
+};
+
+static size_t converted_bytes = 0;
+
+static const Primitive primitives[] = {
+  {"clear", [](PicoGraphics &g, const Shape &s) {
+    g.clear();
+  }},
+  {"rectangle", [](PicoGraphics &g, const Shape &s) {
+    g.rectangle(s.rect);
+  }},
+  {"circle", [](PicoGraphics &g, const Shape &s) {
+    g.circle(s.p[0], s.r);
+  }},
+  {"triangle", [](PicoGraphics &g, const Shape &s) {
+    g.triangle(s.p[0], s.p[1], s.p[2]);
+  }},
+  {"polygon", [](PicoGraphics &g, const Shape &s) {
+    g.polygon({s.p[0], s.p[1], s.p[2], s.p[3], s.p[4], s.p[5]});
+  }},
+  {"line", [](PicoGraphics &g, const Shape &s) {
+    g.line(s.p[0], s.p[1]);
+  }},
+  {"text", [](PicoGraphics &g, const Shape &s) {
+    g.text("Hello World", s.p[0], g.bounds.w, 1);
+  }},
+  {"text_cached", [](PicoGraphics &g, const Shape &s) {
+    static TextCache cache(4096);
+    cache.text(g, "Hello World", s.p[0], g.bounds.w, 1);
+  }},
+  {"write_pixels", [](PicoGraphics &g, const Shape &s) {
+    // a 32x32 RGB888 block, as a plasma effect or camera preview would push
+    static uint8_t block[32 * 32 * 3];
+    g.write_pixels(Rect(s.p[0].x, s.p[0].y, 32, 32), block, PicoGraphics::PEN_RGB888);
+  }},
+  {"scanline_convert", [](PicoGraphics &g, const Shape &s) {
+    g.scanline_convert(PicoGraphics::PEN_RGB565, [](void *data, size_t length) {
+      converted_bytes += length;
+    });
+  }},
+  {"scanline_region", [](PicoGraphics &g, const Shape &s) {
+    Rect region(g.bounds.w / 4, g.bounds.h / 4, g.bounds.w / 2, g.bounds.h / 2);
+    g.scanline_convert(PicoGraphics::PEN_RGB565, region, [](void *data, size_t length) {
+      converted_bytes += length;
+    });
+  }},
+  {"scanline_upscale", [](PicoGraphics &g, const Shape &s) {
+    g.scanline_transform(PicoGraphics::PEN_RGB565, ROTATE_0, 2, [](void *data, size_t length) {
+      converted_bytes += length;
+    });
+  }},
+  {"scanline_rotate", [](PicoGraphics &g, const Shape &s) {
+    static RGB565 band[2048];
+    g.scanline_transform(PicoGraphics::PEN_RGB565, ROTATE_90, 1, [](void *data, size_t length) {
+      converted_bytes += length;
+    }, band, 2048);
+  }},
+};
+
+struct Options {
+  uint32_t duration_ms = 100;
+  bool csv = false;
+  std::vector<std::string> filters;
+};
+
+static bool matches(const Options &options, const std::string &name) {
+  if(options.filters.empty()) return true;
+  for(auto &f : options.filters) {
+    if(name.find(f) != std::string::npos) return true;
+  }
+  return false;
+}
+
+static void print_si(double v, const char *unit) {
+  const char *prefix = " ";
+  if(v >= 1e9) {v /= 1e9; prefix = "G";}
+  else if(v >= 1e6) {v /= 1e6; prefix = "M";}
+  else if(v >= 1e3) {v /= 1e3; prefix = "k";}
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.2f %s%s", v, prefix, unit);
+  printf(" %15s", buf);
+}
+
+int main(int argc, char *argv[]) {
+  Options options;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+      options.duration_ms = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--csv") == 0) {
+      options.csv = true;
+    } else {
+      options.filters.push_back(argv[i]);
+    }
+  }
+
+  if(options.csv) {
+    printf("pen,width,height,primitive,calls_per_sec,pixels_per_sec\n");
+  } else {
+    printf("%-14s %-9s %-18s %15s %15s\n", "pen", "size", "primitive", "calls/sec", "pixels/sec ");
+  }
+
+  for(auto &res : resolutions) {
+    PicoGraphics_PenCounter counter(res.w, res.h);
+    std::vector<Shape> shapes = make_shapes(counter.bounds);
+    counter.set_font("bitmap8");
+
+    for(auto &pen : test_pens) {
+      std::vector<uint8_t> buffer(pen.buffer_size(res.w, res.h));
+      PicoGraphics *g = pen.create(res.w, res.h, buffer.data());
+      g->set_font("bitmap8");
+
+      // two pens to alternate between so that repeated draws always change
+      // the framebuffer
+      int pens[2] = {g->create_pen(255, 255, 255), g->create_pen(255, 0, 0)};
+      if(pens[0] == -1 || pens[1] == -1) {pens[0] = 1; pens[1] = 0;}
+
+      for(auto &prim : primitives) {
+        char size[16];
+        snprintf(size, sizeof(size), "%dx%d", res.w, res.h);
+        std::string name = std::string(pen.name) + "/" + size + "/" + prim.name;
+        if(!matches(options, name)) continue;
+
+        // scanline conversions don't go through the pen, count what they produced
+        bool converts = strncmp(prim.name, "scanline_", 9) == 0;
+
+        // pixels touched by each shape, the counter has no framebuffer to convert
+        uint64_t pixels[SHAPE_COUNT] = {0};
+        for(auto i = 0u; i < SHAPE_COUNT && !converts; i++) {
+          counter.pixels = 0;
+          prim.draw(counter, shapes[i]);
+          pixels[i] = counter.pixels;
+        }
+
+        converted_bytes = 0;
+        uint64_t calls = 0, total_pixels = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0.0;
+        do {
+          for(auto i = 0u; i < SHAPE_COUNT; i++) {
+            g->set_pen(pens[(calls / SHAPE_COUNT) & 1]);
+            prim.draw(*g, shapes[i]);
+            total_pixels += pixels[i];
+            calls++;
+          }
+          elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while(elapsed * 1000.0 < options.duration_ms);
+
+        if(converts) total_pixels = converted_bytes / sizeof(RGB565);
+        bool supported = !converts || converted_bytes > 0;
+
+        double calls_per_sec = calls / elapsed;
+        double pixels_per_sec = total_pixels / elapsed;
+
+        if(options.csv) {
+          if(supported) {
+            printf("%s,%d,%d,%s,%.1f,%.1f\n", pen.name, res.w, res.h, prim.name, calls_per_sec, pixels_per_sec);
+          } else {
+            printf("%s,%d,%d,%s,,\n", pen.name, res.w, res.h, prim.name);
+          }
+        } else {
+          printf("%-14s %-9s %-18s", pen.name, size, prim.name);
+          if(supported) {
+            print_si(calls_per_sec, "");
+            print_si(pixels_per_sec, "px");
+          } else {
+            printf(" %15s %15s", "n/a", "n/a");
+          }
+          printf("\n");
+        }
+      }
+    }
+  }
+
+  return 0;
+}
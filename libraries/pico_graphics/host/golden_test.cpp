@@ -0,0 +1,421 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "libraries/pico_graphics/pico_graphics.hpp"
+
+#include "pens.hpp"
+#include "lato_12.hpp"
+
+using namespace pimoroni;
+
+/*
+  Renders a fixed scene through each pen type and compares the result with a
+  checked-in golden image, then times each step of the scene against a budget.
+
+  Usage: pico_graphics_golden_test <golden dir> [--budgets file] [--output dir]
+                                   [--update] [pen ...]
+
+  A pen fails if its image differs from <golden dir>/<pen>.ppm (the actual
+  image is written to the output directory for inspection) or, when a budgets
+  file is given, if any step takes longer than its budget in microseconds per
+  call. Set the environment variable PICO_GRAPHICS_BUDGET_SCALE to scale every
+  budget, eg: for debug or sanitizer builds. --update rewrites the golden
+  images instead of checking.
+*/
+
+static const uint16_t WIDTH = 128;
+static const uint16_t HEIGHT = 96;
+
+// sets a colour using a pen where the pen type supports it, falling back to
+// the nearest colour for full palettes and 1-bit pens
+static void colour(PicoGraphics &g, uint8_t r, uint8_t gr, uint8_t b) {
+  int pen = g.create_pen(r, gr, b);
+  if(pen == -1) {
+    g.set_pen(r, gr, b);
+  } else {
+    g.set_pen(pen);
+  }
+}
+
+static Path make_icon() {
+  Path icon(24, 24);
+  icon.move_to(Point(12, 22));
+  icon.cubic_to(Point(-4, 10), Point(6, 0), Point(12, 7));
+  icon.cubic_to(Point(18, 0), Point(28, 10), Point(12, 22));
+  icon.close();
+  icon.move_to(Point(8, 9));
+  icon.line_to(Point(8, 12));
+  icon.line_to(Point(11, 12));
+  icon.line_to(Point(11, 9));
+  icon.close();
+  return icon;
+}
+
+static const Path icon = make_icon();
+
+static TextCache text_cache(1024);
+
+struct Step {
+  const char *name;
+  void (*draw)(PicoGraphics &g);
+  // puts back what the step draws over, for steps that would do nothing
+  // when repeated on their own output. run before each timed call but not
+  // counted in its time
+  void (*reset)(PicoGraphics &g);
+};
+
+static const Step scene[] = {
+  {"clear", [](PicoGraphics &g) {
+    colour(g, 0, 0, 0);
+    g.clear();
+  }},
+  {"rectangle", [](PicoGraphics &g) {
+    colour(g, 255, 0, 0);
+    g.rectangle(Rect(4, 4, 30, 20));
+    g.rectangle(Rect(-10, 80, 30, 30));
+  }},
+  {"rounded_rectangle", [](PicoGraphics &g) {
+    colour(g, 0, 0, 255);
+    g.rounded_rectangle(Rect(40, 4, 40, 20), 6);
+  }},
+  {"circle", [](PicoGraphics &g) {
+    colour(g, 0, 255, 0);
+    g.circle(Point(100, 16), 12);
+    g.circle(Point(126, 2), 6);
+  }},
+  {"circle_outline", [](PicoGraphics &g) {
+    colour(g, 255, 255, 0);
+    g.circle_outline(Point(100, 16), 14);
+  }},
+  {"ellipse", [](PicoGraphics &g) {
+    colour(g, 255, 0, 255);
+    g.ellipse(Point(20, 40), 16, 8);
+    colour(g, 0, 255, 255);
+    g.ellipse_outline(Point(20, 40), 18, 10);
+  }},
+  {"arc", [](PicoGraphics &g) {
+    colour(g, 255, 128, 0);
+    g.arc(Point(60, 44), 14, 4, -90, 135);
+  }},
+  {"triangle", [](PicoGraphics &g) {
+    colour(g, 128, 0, 255);
+    g.triangle(Point(84, 34), Point(124, 40), Point(96, 60));
+  }},
+  {"polygon", [](PicoGraphics &g) {
+    colour(g, 255, 255, 255);
+    g.polygon({Point(4, 60), Point(20, 56), Point(36, 64), Point(28, 76), Point(10, 74)});
+  }},
+  {"line", [](PicoGraphics &g) {
+    colour(g, 0, 128, 255);
+    g.line(Point(0, 95), Point(127, 50));
+    g.line(Point(40, 60), Point(40, 90));
+    g.line(Point(44, 62), Point(80, 62));
+  }},
+  {"text", [](PicoGraphics &g) {
+    colour(g, 255, 255, 255);
+    g.set_font("bitmap8");
+    g.text("Pico", Point(46, 66), WIDTH, 1);
+    g.set_font("sans");
+    g.text("Gfx", Point(46, 86), WIDTH, 0.5f);
+    g.set_font("bitmap6");
+  }},
+  {"linear_gradient", [](PicoGraphics &g) {
+    g.linear_gradient(Rect(84, 64, 40, 12), RGB(255, 0, 0), RGB(0, 0, 255));
+  }},
+  {"radial_gradient", [](PicoGraphics &g) {
+    // the gradient shouldn't change the current pen
+    colour(g, 255, 255, 0);
+    g.radial_gradient(Point(104, 86), 9, RGB(255, 255, 255), RGB(0, 64, 0));
+    g.pixel_span(Point(84, 76), 30);
+  }},
+  {"fill_path", [](PicoGraphics &g) {
+    colour(g, 255, 0, 128);
+    g.fill_path(icon, Point(56, 72));
+  }},
+  {"stroke_path", [](PicoGraphics &g) {
+    colour(g, 128, 255, 0);
+    g.stroke_path(icon, 2, Point(4, 24), 0.5f);
+  }},
+  {"flood_fill", [](PicoGraphics &g) {
+    colour(g, 64, 64, 255);
+    g.flood_fill(Point(100, 30));
+  }, [](PicoGraphics &g) {
+    colour(g, 255, 255, 0);
+    g.circle_outline(Point(100, 16), 14);
+  }},
+  {"pixel", [](PicoGraphics &g) {
+    colour(g, 255, 255, 255);
+    for(auto i = 0; i < 16; i++) {
+      g.pixel(Point(i * 8, 0));
+    }
+    g.pixel_span(Point(0, 1), 128);
+  }},
+  {"clip", [](PicoGraphics &g) {
+    colour(g, 0, 255, 128);
+    g.set_clip(Rect(64, 48, 16, 16));
+    g.circle(Point(72, 56), 12);
+    g.remove_clip();
+  }},
+  {"copy_rect", [](PicoGraphics &g) {
+    g.copy_rect(Rect(0, 0, 14, 20), Point(114, 76));
+    g.scroll(Rect(83, 33, 41, 29), -3, 5);
+    // the fill shouldn't change the current pen
+    colour(g, 255, 255, 255);
+    g.scroll(Rect(114, 76, 14, 20), 0, 3, g.create_pen(0, 0, 255));
+    g.pixel_span(Point(114, 75), 14);
+  }},
+  {"write_pixels", [](PicoGraphics &g) {
+    static uint8_t block[24 * 12 * 3];
+    for(auto i = 0u; i < 24 * 12; i++) {
+      block[i * 3 + 0] = (i % 24) * 10;
+      block[i * 3 + 1] = (i / 24) * 20;
+      block[i * 3 + 2] = 255 - (i % 24) * 10;
+    }
+    g.write_pixels(Rect(-4, 28, 24, 12), block, PicoGraphics::PEN_RGB888);
+  }},
+  {"push_clip", [](PicoGraphics &g) {
+    colour(g, 255, 128, 128);
+    g.push_clip(Rect(44, 28, 30, 20));
+    g.push_clip(Rect(56, 36, 30, 30));
+    g.circle(Point(62, 42), 10);
+    g.pop_clip();
+    colour(g, 128, 128, 255);
+    g.line(Point(40, 26), Point(80, 50));
+    g.pop_clip();
+  }},
+  {"text_cache", [](PicoGraphics &g) {
+    colour(g, 255, 192, 0);
+    g.set_font("bitmap8");
+    text_cache.text(g, "Cache", Point(86, 44), WIDTH, 1);
+    text_cache.text(g, "Cache", Point(86, 52), WIDTH, 1);
+    g.set_font("bitmap6");
+  }},
+  {"scanline_convert", [](PicoGraphics &g) {
+    // copies a region back in through the RGB565 output
+    static uint8_t block[20 * 10 * 3];
+    uint8_t *dest = block;
+    g.scanline_convert(PicoGraphics::PEN_RGB565, Rect(40, 4, 20, 10), [&](void *data, size_t length) {
+      const RGB565 *src = (const RGB565 *)data;
+      for(auto i = 0u; i < length / sizeof(RGB565); i++) {
+        RGB c(src[i]);
+        *dest++ = c.r; *dest++ = c.g; *dest++ = c.b;
+      }
+    });
+    g.write_pixels(Rect(104, 4, 20, 10), block, PicoGraphics::PEN_RGB888);
+  }},
+  {"scanline_transform", [](PicoGraphics &g) {
+    // copies the corner of the frame rotated a quarter turn back in
+    static uint8_t block[24 * 12 * 3];
+    uint8_t *dest = block;
+    uint row = 0;
+    g.scanline_transform(PicoGraphics::PEN_RGB565, ROTATE_90, 1, [&](void *data, size_t length) {
+      if(row++ >= 12) return;
+      const RGB565 *src = (const RGB565 *)data;
+      for(auto i = 0u; i < 24; i++) {
+        RGB c(src[i]);
+        *dest++ = c.r; *dest++ = c.g; *dest++ = c.b;
+      }
+    });
+    g.write_pixels(Rect(4, 82, 24, 12), block, PicoGraphics::PEN_RGB888);
+  }},
+  {"alpha_text", [](PicoGraphics &g) {
+    colour(g, 0, 255, 255);
+    g.set_font(&lato_12);
+    g.text("Alpha", Point(84, 22), WIDTH);
+    for(auto i = 0; i < 16; i++) {
+      g.set_pixel_alpha(Point(84 + i, 38), i * 17);
+    }
+    g.set_font("bitmap6");
+  }},
+};
+
+// converts a pixel in any pen format to RGB for the PPM dump
+static RGB to_rgb(PicoGraphics &g, const Point &p) {
+  uint v = g.get_pixel(p);
+  switch(g.pen_type) {
+    case PicoGraphics::PEN_1BIT:
+    case PicoGraphics::PEN_1BIT_PAGED:
+      return v ? RGB(255, 255, 255) : RGB(0, 0, 0);
+    case PicoGraphics::PEN_P4:
+      return static_cast<PicoGraphics_PenP4 &>(g).palette[v];
+    case PicoGraphics::PEN_P8:
+      return static_cast<PicoGraphics_PenP8 &>(g).palette[v];
+    case PicoGraphics::PEN_RGB332:
+      return RGB((RGB332)v);
+    case PicoGraphics::PEN_RGB565:
+    case PicoGraphics::PEN_RGB565_TILED:
+      return RGB((RGB565)v);
+    default:
+      return RGB();
+  }
+}
+
+static std::vector<uint8_t> to_ppm(PicoGraphics &g) {
+  char header[32];
+  int len = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", g.bounds.w, g.bounds.h);
+  std::vector<uint8_t> ppm(header, header + len);
+  for(auto y = 0; y < g.bounds.h; y++) {
+    for(auto x = 0; x < g.bounds.w; x++) {
+      RGB c = to_rgb(g, Point(x, y));
+      ppm.push_back(c.r);
+      ppm.push_back(c.g);
+      ppm.push_back(c.b);
+    }
+  }
+  return ppm;
+}
+
+static bool read_file(const std::string &path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if(!f) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    data.insert(data.end(), buf, buf + n);
+  }
+  fclose(f);
+  return true;
+}
+
+static bool write_file(const std::string &path, const std::vector<uint8_t> &data) {
+  FILE *f = fopen(path.c_str(), "wb");
+  if(!f) return false;
+  bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  fclose(f);
+  return ok;
+}
+
+// budgets file: one "<step> <microseconds per call>" per line, # comments
+static bool read_budgets(const std::string &path, std::vector<std::pair<std::string, double>> &budgets) {
+  FILE *f = fopen(path.c_str(), "r");
+  if(!f) return false;
+  char line[256];
+  while(fgets(line, sizeof(line), f)) {
+    char name[128];
+    double us;
+    if(line[0] == '#') continue;
+    if(sscanf(line, "%127s %lf", name, &us) == 2) {
+      budgets.push_back({name, us});
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// average time for one call of a step in microseconds. takes the fastest of
+// several short batches so that a busy machine doesn't cause false failures
+static double time_step(PicoGraphics &g, const Step &step) {
+  double best = 0.0;
+  for(auto batch = 0; batch < 5; batch++) {
+    uint calls = 0;
+    double elapsed = 0.0;
+    do {
+      if(step.reset) step.reset(g);
+      auto start = std::chrono::steady_clock::now();
+      step.draw(g);
+      calls++;
+      elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while(elapsed < 0.001 || calls < 4);
+    double us = elapsed * 1e6 / calls;
+    if(batch == 0 || us < best) best = us;
+  }
+  return best;
+}
+
+int main(int argc, char *argv[]) {
+  if(argc < 2) {
+    fprintf(stderr, "usage: %s <golden dir> [--budgets file] [--output dir] [--update] [pen ...]\n", argv[0]);
+    return 2;
+  }
+
+  std::string golden_dir = argv[1];
+  std::string output_dir = ".";
+  std::string budgets_path;
+  bool update = false;
+  std::vector<std::string> pens;
+
+  for(int i = 2; i < argc; i++) {
+    if(strcmp(argv[i], "--budgets") == 0 && i + 1 < argc) {
+      budgets_path = argv[++i];
+    } else if(strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+      output_dir = argv[++i];
+    } else if(strcmp(argv[i], "--update") == 0) {
+      update = true;
+    } else {
+      pens.push_back(argv[i]);
+    }
+  }
+
+  std::vector<std::pair<std::string, double>> budgets;
+  if(!budgets_path.empty() && !read_budgets(budgets_path, budgets)) {
+    fprintf(stderr, "unable to read budgets from %s\n", budgets_path.c_str());
+    return 2;
+  }
+
+  double budget_scale = 1.0;
+  if(const char *scale = getenv("PICO_GRAPHICS_BUDGET_SCALE")) {
+    budget_scale = atof(scale);
+  }
+
+  int failures = 0;
+
+  for(auto &pen : test_pens) {
+    if(!pens.empty() && std::find(pens.begin(), pens.end(), pen.name) == pens.end()) continue;
+
+    std::vector<uint8_t> buffer(pen.buffer_size(WIDTH, HEIGHT));
+    PicoGraphics *g = pen.create(WIDTH, HEIGHT, buffer.data());
+
+    for(auto &step : scene) {
+      step.draw(*g);
+    }
+
+    std::vector<uint8_t> actual = to_ppm(*g);
+    std::string golden_path = golden_dir + "/" + pen.name + ".ppm";
+
+    if(update) {
+      if(!write_file(golden_path, actual)) {
+        fprintf(stderr, "%s: unable to write %s\n", pen.name, golden_path.c_str());
+        failures++;
+      } else {
+        printf("%s: updated %s\n", pen.name, golden_path.c_str());
+      }
+      continue;
+    }
+
+    std::vector<uint8_t> golden;
+    if(!read_file(golden_path, golden)) {
+      printf("%s: FAIL missing golden image %s\n", pen.name, golden_path.c_str());
+      failures++;
+    } else if(golden != actual) {
+      std::string actual_path = output_dir + "/" + pen.name + ".actual.ppm";
+      write_file(actual_path, actual);
+      printf("%s: FAIL image differs from %s, see %s\n", pen.name, golden_path.c_str(), actual_path.c_str());
+      failures++;
+    } else {
+      printf("%s: image matches\n", pen.name);
+    }
+
+    // time each step on top of the finished scene
+    for(auto &step : scene) {
+      double us = time_step(*g, step);
+      double budget = 0.0;
+      for(auto &b : budgets) {
+        if(b.first == step.name) budget = b.second * budget_scale;
+      }
+      bool over = budget > 0.0 && us > budget;
+      if(budget > 0.0) {
+        printf("  %-18s %9.2f us/call (budget %9.2f)%s\n", step.name, us, budget, over ? " FAIL" : "");
+      } else {
+        printf("  %-18s %9.2f us/call\n", step.name, us);
+      }
+      if(over) failures++;
+    }
+  }
+
+  return failures ? 1 : 0;
+}
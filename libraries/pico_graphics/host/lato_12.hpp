@@ -0,0 +1,253 @@
+#pragma once
+
+#include "bitmap_fonts.hpp"
+
+// Lato-Regular.ttf at 12px converted by ttf-to-alpha-font.py
+
+static const bitmap::alpha_glyph_t lato_12_glyphs[95] = {
+  // offset, width, height, x_offset, y_offset, advance
+  {     0,   0,   0,    0,    0,   2}, // ' '
+  {     0,   2,   8,    1,    4,   4}, // '!'
+  {    16,   4,   3,    0,    4,   5}, // '"'
+  {    28,   7,   8,    0,    4,   7}, // '#'
+  {    84,   7,  12,    0,    2,   7}, // '$'
+  {   168,   9,   8,    0,    4,   9}, // '%'
+  {   240,   9,   8,    0,    4,   8}, // '&'
+  {   312,   2,   3,    0,    4,   3}, // "'"
+  {   318,   4,  12,    0,    2,   4}, // '('
+  {   366,   3,  12,    0,    2,   4}, // ')'
+  {   402,   5,   4,    0,    3,   5}, // '*'
+  {   422,   7,   6,    0,    5,   7}, // '+'
+  {   464,   2,   3,    0,   11,   3}, // ','
+  {   470,   4,   1,    0,    8,   4}, // '-'
+  {   474,   2,   1,    0,   11,   3}, // '.'
+  {   476,   6,   9,   -1,    3,   4}, // '/'
+  {   530,   7,   8,    0,    4,   7}, // '0'
+  {   586,   6,   8,    1,    4,   7}, // '1'
+  {   634,   7,   8,    0,    4,   7}, // '2'
+  {   690,   7,   8,    0,    4,   7}, // '3'
+  {   746,   7,   8,    0,    4,   7}, // '4'
+  {   802,   7,   8,    0,    4,   7}, // '5'
+  {   858,   7,   8,    0,    4,   7}, // '6'
+  {   914,   7,   8,    0,    4,   7}, // '7'
+  {   970,   7,   8,    0,    4,   7}, // '8'
+  {  1026,   7,   8,    0,    4,   7}, // '9'
+  {  1082,   3,   6,    0,    6,   3}, // ':'
+  {  1100,   3,   8,    0,    6,   3}, // ';'
+  {  1124,   6,   6,    0,    5,   7}, // '<'
+  {  1160,   7,   3,    0,    7,   7}, // '='
+  {  1181,   6,   6,    1,    5,   7}, // '>'
+  {  1217,   5,   8,    0,    4,   5}, // '?'
+  {  1257,  10,  10,    0,    4,  10}, // '@'
+  {  1357,   9,   8,    0,    4,   8}, // 'A'
+  {  1429,   7,   8,    1,    4,   8}, // 'B'
+  {  1485,   8,   8,    0,    4,   8}, // 'C'
+  {  1549,   8,   8,    1,    4,   9}, // 'D'
+  {  1613,   6,   8,    1,    4,   7}, // 'E'
+  {  1661,   6,   8,    1,    4,   7}, // 'F'
+  {  1709,   9,   8,    0,    4,   9}, // 'G'
+  {  1781,   8,   8,    1,    4,   9}, // 'H'
+  {  1845,   2,   8,    1,    4,   4}, // 'I'
+  {  1861,   5,   8,    0,    4,   5}, // 'J'
+  {  1901,   7,   8,    1,    4,   8}, // 'K'
+  {  1957,   5,   8,    1,    4,   6}, // 'L'
+  {  1997,   9,   8,    1,    4,  11}, // 'M'
+  {  2069,   8,   8,    1,    4,   9}, // 'N'
+  {  2133,  10,   8,    0,    4,  10}, // 'O'
+  {  2213,   6,   8,    1,    4,   7}, // 'P'
+  {  2261,  10,  10,    0,    4,  10}, // 'Q'
+  {  2361,   7,   8,    1,    4,   8}, // 'R'
+  {  2417,   6,   8,    0,    4,   6}, // 'S'
+  {  2465,   7,   8,    0,    4,   7}, // 'T'
+  {  2521,   8,   8,    0,    4,   9}, // 'U'
+  {  2585,   9,   8,    0,    4,   8}, // 'V'
+  {  2657,  13,   8,    0,    4,  12}, // 'W'
+  {  2761,   8,   8,    0,    4,   8}, // 'X'
+  {  2825,   8,   8,    0,    4,   8}, // 'Y'
+  {  2889,   8,   8,    0,    4,   7}, // 'Z'
+  {  2953,   4,  11,    0,    3,   4}, // '['
+  {  2997,   6,   9,   -1,    3,   5}, // '\\'
+  {  3051,   3,  11,    0,    3,   4}, // ']'
+  {  3084,   5,   4,    1,    4,   7}, // '^'
+  {  3104,   5,   1,    0,   13,   5}, // '_'
+  {  3109,   3,   2,    0,    4,   4}, // '`'
+  {  3115,   6,   6,    0,    6,   6}, // 'a'
+  {  3151,   7,   9,    0,    3,   7}, // 'b'
+  {  3214,   6,   6,    0,    6,   6}, // 'c'
+  {  3250,   6,   9,    0,    3,   7}, // 'd'
+  {  3304,   6,   6,    0,    6,   6}, // 'e'
+  {  3340,   4,   8,    0,    4,   4}, // 'f'
+  {  3372,   6,   8,    0,    6,   6}, // 'g'
+  {  3420,   6,   9,    0,    3,   7}, // 'h'
+  {  3474,   3,   9,    0,    3,   3}, // 'i'
+  {  3501,   4,  11,   -1,    3,   3}, // 'j'
+  {  3545,   7,   9,    0,    3,   6}, // 'k'
+  {  3608,   2,   9,    1,    3,   3}, // 'l'
+  {  3626,  10,   6,    0,    6,  10}, // 'm'
+  {  3686,   6,   6,    0,    6,   7}, // 'n'
+  {  3722,   7,   6,    0,    6,   7}, // 'o'
+  {  3764,   7,   8,    0,    6,   7}, // 'p'
+  {  3820,   6,   8,    0,    6,   7}, // 'q'
+  {  3868,   5,   6,    0,    6,   5}, // 'r'
+  {  3898,   5,   6,    0,    6,   5}, // 's'
+  {  3928,   5,   8,    0,    4,   4}, // 't'
+  {  3968,   6,   6,    0,    6,   7}, // 'u'
+  {  4004,   6,   6,    0,    6,   6}, // 'v'
+  {  4040,  10,   6,    0,    6,   9}, // 'w'
+  {  4100,   6,   6,    0,    6,   6}, // 'x'
+  {  4136,   6,   8,    0,    6,   6}, // 'y'
+  {  4184,   6,   6,    0,    6,   6}, // 'z'
+  {  4220,   4,  11,    0,    3,   4}, // '{'
+  {  4264,   2,  11,    1,    3,   4}, // '|'
+  {  4286,   4,  11,    0,    3,   4}, // '}'
+  {  4330,   7,   3,    0,    7,   7}, // '~'
+};
+
+static const uint8_t lato_12_data[2176] = {
+  0x79, 0x79, 0x79, 0x68, 0x57, 0x00, 0x00, 0x89, 0x1d, 0x1d, 0x1d, 0x1d, 0x0a, 0x0a, 0x00, 0x76,
+  0x2b, 0x00, 0x0b, 0x26, 0x70, 0x4f, 0xff, 0xff, 0x80, 0x1c, 0x0b, 0x20, 0x04, 0x90, 0xd0, 0x09,
+  0xff, 0xff, 0xf3, 0x0a, 0x44, 0x90, 0x00, 0xc0, 0x75, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x64,
+  0x00, 0x03, 0xbe, 0xd8, 0x00, 0xc4, 0x82, 0x40, 0x0e, 0x39, 0x10, 0x00, 0x5e, 0xe5, 0x00, 0x00,
+  0x1c, 0xad, 0x10, 0x00, 0xa0, 0xb5, 0x17, 0x0a, 0x1d, 0x21, 0x8d, 0xec, 0x50, 0x00, 0x1a, 0x00,
+  0x00, 0x01, 0x80, 0x00, 0x1c, 0xe8, 0x00, 0x1c, 0x27, 0x71, 0xc2, 0x0b, 0x30, 0x77, 0x1b, 0x29,
+  0x60, 0x01, 0xce, 0x86, 0x90, 0x00, 0x00, 0x03, 0xb4, 0xde, 0x50, 0x01, 0xc1, 0xb4, 0x2d, 0x00,
+  0xb3, 0x0b, 0x32, 0xd0, 0x96, 0x00, 0x3d, 0xe5, 0x00, 0x8e, 0xd5, 0x00, 0x00, 0x3d, 0x22, 0xd1,
+  0x00, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x1b, 0x6a, 0xa0, 0x85, 0x06, 0xa0,
+  0x08, 0xbc, 0x10, 0x5d, 0x21, 0x4d, 0xd1, 0x00, 0x8e, 0xeb, 0x25, 0xc1, 0x1d, 0x1d, 0x0a, 0x00,
+  0x20, 0x01, 0xd0, 0x07, 0x80, 0x0c, 0x20, 0x1e, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x2d, 0x00, 0x0e,
+  0x10, 0x0a, 0x50, 0x04, 0xb0, 0x00, 0x70, 0x11, 0x06, 0x80, 0x1d, 0x10, 0x95, 0x06, 0x80, 0x4a,
+  0x04, 0xa0, 0x59, 0x08, 0x70, 0xc2, 0x4b, 0x04, 0x30, 0x10, 0x81, 0x02, 0x9b, 0x81, 0x29, 0xb9,
+  0x11, 0x08, 0x10, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x0d, 0x00, 0x06, 0xff, 0xff,
+  0xf5, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x4d, 0x0a, 0x22, 0x6f, 0xf8, 0x5c, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0xc0, 0x00, 0x05, 0x80, 0x00, 0x0b, 0x20, 0x00, 0x3a, 0x00, 0x00, 0x94, 0x00,
+  0x01, 0xc0, 0x00, 0x07, 0x60, 0x00, 0x0c, 0x10, 0x00, 0x04, 0xce, 0xc3, 0x02, 0xe5, 0x16, 0xe1,
+  0x7a, 0x00, 0x0b, 0x69, 0x70, 0x00, 0x88, 0x97, 0x00, 0x08, 0x87, 0xa0, 0x00, 0xb6, 0x1e, 0x51,
+  0x6e, 0x10, 0x3c, 0xec, 0x30, 0x02, 0xca, 0x00, 0x4d, 0xba, 0x00, 0x42, 0x7a, 0x00, 0x00, 0x7a,
+  0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x7a, 0x00, 0x4f, 0xff, 0xf5, 0x03, 0xce, 0xd5,
+  0x00, 0xd5, 0x15, 0xf1, 0x15, 0x00, 0x0e, 0x20, 0x00, 0x05, 0xb0, 0x00, 0x03, 0xc1, 0x00, 0x04,
+  0xc1, 0x00, 0x05, 0xb1, 0x00, 0x04, 0xfe, 0xff, 0xf5, 0x03, 0xbe, 0xd7, 0x00, 0xd5, 0x03, 0xe2,
+  0x01, 0x00, 0x4d, 0x10, 0x00, 0xdf, 0x50, 0x00, 0x01, 0x4e, 0x32, 0x50, 0x00, 0xa6, 0x1e, 0x51,
+  0x4e, 0x20, 0x4c, 0xed, 0x50, 0x00, 0x01, 0xd6, 0x00, 0x00, 0xbb, 0x60, 0x00, 0x96, 0x86, 0x00,
+  0x69, 0x08, 0x60, 0x3b, 0x00, 0x86, 0x0a, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x86, 0x00, 0x00, 0x08,
+  0x60, 0x05, 0xff, 0xfc, 0x00, 0x85, 0x00, 0x00, 0x0c, 0xee, 0xb2, 0x00, 0x31, 0x18, 0xc0, 0x00,
+  0x00, 0x0f, 0x10, 0x00, 0x01, 0xf0, 0x17, 0x21, 0xaa, 0x01, 0x9e, 0xe9, 0x10, 0x00, 0x05, 0xd1,
+  0x00, 0x03, 0xe3, 0x00, 0x01, 0xd5, 0x00, 0x00, 0xae, 0xee, 0x70, 0x3e, 0x41, 0x4e, 0x35, 0xb0,
+  0x00, 0xa6, 0x1e, 0x41, 0x4e, 0x20, 0x4c, 0xec, 0x40, 0x5f, 0xff, 0xff, 0x70, 0x00, 0x01, 0xd2,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x2d, 0x10, 0x00, 0x09, 0x70, 0x00, 0x03, 0xd1, 0x00, 0x00, 0xb6,
+  0x00, 0x00, 0x4d, 0x00, 0x00, 0x05, 0xdf, 0xc4, 0x01, 0xe4, 0x04, 0xe0, 0x0e, 0x40, 0x4d, 0x00,
+  0x5f, 0xfe, 0x40, 0x2e, 0x41, 0x4e, 0x26, 0xb0, 0x00, 0xc5, 0x3e, 0x41, 0x4e, 0x20, 0x5d, 0xec,
+  0x50, 0x02, 0xbe, 0xd6, 0x00, 0xc7, 0x13, 0xd3, 0x1f, 0x00, 0x09, 0x60, 0xe6, 0x13, 0xe4, 0x04,
+  0xde, 0xdc, 0x00, 0x00, 0x2d, 0x20, 0x00, 0x1c, 0x50, 0x00, 0x0b, 0x80, 0x00, 0x2e, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xe2, 0x2e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 0x09,
+  0x11, 0x40, 0x00, 0x00, 0x24, 0x00, 0x29, 0xc3, 0x09, 0xc5, 0x00, 0x08, 0xc6, 0x00, 0x00, 0x18,
+  0xd4, 0x00, 0x00, 0x14, 0x1f, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x15, 0x20,
+  0x00, 0x04, 0xc9, 0x20, 0x00, 0x05, 0xc8, 0x00, 0x06, 0xc7, 0x04, 0xd8, 0x10, 0x04, 0x10, 0x00,
+  0x04, 0xde, 0xb1, 0x42, 0x1a, 0x70, 0x00, 0x96, 0x00, 0x7a, 0x00, 0x3b, 0x00, 0x02, 0x40, 0x00,
+  0x00, 0x00, 0x07, 0xa0, 0x00, 0x02, 0x9e, 0xeb, 0x40, 0x00, 0x3d, 0x61, 0x14, 0xc5, 0x00, 0xc3,
+  0x00, 0x00, 0x1c, 0x04, 0x90, 0x19, 0xed, 0x18, 0x46, 0x50, 0xa7, 0x1c, 0x06, 0x57, 0x51, 0xc0,
+  0x39, 0x08, 0x44, 0x82, 0xc1, 0x99, 0x2c, 0x00, 0xd3, 0xae, 0x5c, 0xd3, 0x00, 0x4d, 0x62, 0x01,
+  0x34, 0x00, 0x02, 0xae, 0xfd, 0x81, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x2e, 0xc5, 0x00, 0x00,
+  0x09, 0x86, 0xb0, 0x00, 0x01, 0xe2, 0x0e, 0x30, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x0d, 0xff, 0xff,
+  0xf1, 0x04, 0xe0, 0x00, 0x0b, 0x70, 0xb7, 0x00, 0x00, 0x4d, 0x0e, 0xff, 0xeb, 0x30, 0xe3, 0x01,
+  0x9b, 0x0e, 0x30, 0x19, 0x80, 0xef, 0xff, 0xc1, 0x0e, 0x30, 0x18, 0xd0, 0xe3, 0x00, 0x1f, 0x1e,
+  0x30, 0x18, 0xc0, 0xef, 0xfe, 0xb2, 0x00, 0x05, 0xcf, 0xea, 0x20, 0x8d, 0x51, 0x16, 0x52, 0xf2,
+  0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x03, 0xf2, 0x00, 0x00, 0x00, 0x9d,
+  0x41, 0x17, 0x60, 0x06, 0xdf, 0xe9, 0x1e, 0xff, 0xfc, 0x60, 0x0e, 0x30, 0x14, 0xca, 0x0e, 0x30,
+  0x00, 0x2f, 0x3e, 0x30, 0x00, 0x0c, 0x7e, 0x30, 0x00, 0x0c, 0x7e, 0x30, 0x00, 0x2f, 0x3e, 0x30,
+  0x14, 0xca, 0x0e, 0xff, 0xfd, 0x60, 0x0e, 0xff, 0xff, 0x5e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e,
+  0xff, 0xf8, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0xff, 0xff, 0x5e, 0xff,
+  0xff, 0x5e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0xff, 0xfb, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00,
+  0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x05, 0xcf, 0xeb, 0x40, 0x08, 0xd5, 0x11, 0x47, 0x03,
+  0xf2, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x8f, 0xf1, 0x2f, 0x20, 0x00,
+  0x0f, 0x10, 0x8d, 0x41, 0x03, 0xf1, 0x00, 0x5c, 0xfe, 0xc5, 0x0e, 0x30, 0x00, 0x2f, 0x0e, 0x30,
+  0x00, 0x2f, 0x0e, 0x30, 0x00, 0x2f, 0x0e, 0xff, 0xff, 0xff, 0x0e, 0x30, 0x00, 0x2f, 0x0e, 0x30,
+  0x00, 0x2f, 0x0e, 0x30, 0x00, 0x2f, 0x0e, 0x30, 0x00, 0x2f, 0x0b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x6b, 0x6b, 0x60, 0x00, 0xd4, 0x00, 0x0d, 0x40, 0x00, 0xd4, 0x00, 0x0d, 0x40, 0x00, 0xd4, 0x00,
+  0x0e, 0x30, 0x06, 0xe1, 0x8f, 0xc4, 0x0d, 0x50, 0x03, 0xd4, 0xd5, 0x04, 0xd4, 0x0d, 0x55, 0xd3,
+  0x00, 0xdf, 0xf6, 0x00, 0x0d, 0x55, 0xe3, 0x00, 0xd5, 0x07, 0xd1, 0x0d, 0x50, 0x09, 0xc0, 0xd5,
+  0x00, 0x0b, 0x9e, 0x30, 0x00, 0xe3, 0x00, 0x0e, 0x30, 0x00, 0xe3, 0x00, 0x0e, 0x30, 0x00, 0xe3,
+  0x00, 0x0e, 0x30, 0x00, 0xef, 0xff, 0xee, 0x70, 0x00, 0x00, 0x7f, 0xec, 0x20, 0x00, 0x1c, 0xfe,
+  0x4a, 0x00, 0x0a, 0x5f, 0xe1, 0xa5, 0x04, 0xb0, 0xfe, 0x12, 0xd1, 0xc3, 0x0f, 0xe1, 0x08, 0xca,
+  0x00, 0xfe, 0x10, 0x1c, 0x20, 0x0f, 0xe1, 0x00, 0x00, 0x00, 0xfe, 0x40, 0x00, 0x0f, 0x0e, 0xb2,
+  0x00, 0x0f, 0x0e, 0x3b, 0x00, 0x0f, 0x0e, 0x14, 0x90, 0x0f, 0x0e, 0x10, 0x85, 0x0f, 0x0e, 0x10,
+  0x0a, 0x3f, 0x0e, 0x10, 0x01, 0xbf, 0x0e, 0x10, 0x00, 0x3f, 0x00, 0x05, 0xcf, 0xea, 0x20, 0x00,
+  0x8d, 0x41, 0x28, 0xe3, 0x02, 0xf2, 0x00, 0x00, 0x8b, 0x06, 0xc0, 0x00, 0x00, 0x4f, 0x06, 0xc0,
+  0x00, 0x00, 0x4f, 0x03, 0xf2, 0x00, 0x00, 0x8b, 0x00, 0x8d, 0x41, 0x27, 0xe3, 0x00, 0x06, 0xcf,
+  0xea, 0x20, 0x0d, 0xff, 0xe9, 0x1d, 0x50, 0x2b, 0xad, 0x50, 0x05, 0xdd, 0x50, 0x2b, 0x9d, 0xff,
+  0xd9, 0x1d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x05, 0xcf, 0xea, 0x20, 0x00,
+  0x8d, 0x41, 0x28, 0xe3, 0x02, 0xf2, 0x00, 0x00, 0x8b, 0x06, 0xc0, 0x00, 0x00, 0x4f, 0x06, 0xc0,
+  0x00, 0x00, 0x4e, 0x03, 0xf2, 0x00, 0x00, 0x8b, 0x00, 0x8d, 0x41, 0x27, 0xe3, 0x00, 0x06, 0xcf,
+  0xee, 0x70, 0x00, 0x00, 0x00, 0x03, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x2d, 0xff, 0xd9, 0x10,
+  0xd5, 0x02, 0xc8, 0x0d, 0x50, 0x07, 0xb0, 0xd5, 0x03, 0xc6, 0x0d, 0xff, 0xe6, 0x00, 0xd5, 0x2d,
+  0x50, 0x0d, 0x50, 0x3e, 0x40, 0xd5, 0x00, 0x4d, 0x20, 0x5d, 0xec, 0x32, 0xe3, 0x14, 0x43, 0xe1,
+  0x00, 0x00, 0x9d, 0x83, 0x00, 0x02, 0x6d, 0x70, 0x00, 0x04, 0xd5, 0x71, 0x19, 0xa1, 0xae, 0xea,
+  0x1c, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0x20, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x01,
+  0xf2, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x1f, 0x20, 0x01, 0xf2, 0x00, 0x05,
+  0xc1, 0xf2, 0x00, 0x05, 0xc1, 0xf2, 0x00, 0x05, 0xc1, 0xf2, 0x00, 0x05, 0xc1, 0xf2, 0x00, 0x05,
+  0xc0, 0xe4, 0x00, 0x08, 0xa0, 0x8c, 0x31, 0x4e, 0x40, 0x07, 0xde, 0xc5, 0x0b, 0x70, 0x00, 0x05,
+  0xd0, 0x5d, 0x00, 0x00, 0xb7, 0x00, 0xd5, 0x00, 0x3e, 0x10, 0x06, 0xc0, 0x09, 0x90, 0x00, 0x1e,
+  0x31, 0xe2, 0x00, 0x00, 0x89, 0x7b, 0x00, 0x00, 0x02, 0xed, 0x40, 0x00, 0x00, 0x0a, 0xc0, 0x00,
+  0x0b, 0x80, 0x00, 0x7c, 0x00, 0x03, 0xe0, 0x6d, 0x00, 0x0d, 0xe2, 0x00, 0x8a, 0x01, 0xf2, 0x03,
+  0xc8, 0x80, 0x0d, 0x40, 0x0b, 0x70, 0x96, 0x3d, 0x03, 0xe0, 0x00, 0x6c, 0x0e, 0x10, 0xd4, 0x89,
+  0x00, 0x01, 0xf7, 0xb0, 0x07, 0x9d, 0x40, 0x00, 0x0b, 0xe5, 0x00, 0x2e, 0xe0, 0x00, 0x00, 0x6e,
+  0x10, 0x00, 0xc9, 0x00, 0x07, 0xd0, 0x00, 0x2e, 0x30, 0xa8, 0x00, 0xb6, 0x00, 0x1d, 0x36, 0xa0,
+  0x00, 0x04, 0xcd, 0x10, 0x00, 0x06, 0xad, 0x30, 0x00, 0x2d, 0x15, 0xc0, 0x00, 0xc5, 0x00, 0xa8,
+  0x08, 0xa0, 0x00, 0x2e, 0x49, 0x90, 0x00, 0x2e, 0x31, 0xe4, 0x00, 0xa8, 0x00, 0x5d, 0x05, 0xd0,
+  0x00, 0x0a, 0x8d, 0x40, 0x00, 0x01, 0xe9, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00,
+  0x00, 0x00, 0xc5, 0x00, 0x04, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x01, 0xd5, 0x00, 0x00, 0x0a, 0x80,
+  0x00, 0x00, 0x7b, 0x00, 0x00, 0x04, 0xd1, 0x00, 0x00, 0x1d, 0x30, 0x00, 0x00, 0xb7, 0x00, 0x00,
+  0x06, 0xff, 0xff, 0xfe, 0x02, 0xff, 0x12, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0,
+  0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xff, 0x10, 0xc0, 0x00, 0x00, 0x86, 0x00,
+  0x00, 0x2c, 0x00, 0x00, 0x0a, 0x30, 0x00, 0x04, 0x90, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x67, 0x00,
+  0x00, 0x1c, 0x00, 0x00, 0x08, 0x46, 0xfb, 0x02, 0xb0, 0x2b, 0x02, 0xb0, 0x2b, 0x02, 0xb0, 0x2b,
+  0x02, 0xb0, 0x2b, 0x02, 0xb6, 0xfb, 0x03, 0xe1, 0x00, 0xba, 0x90, 0x4b, 0x0c, 0x2c, 0x30, 0x4a,
+  0xff, 0xff, 0xb4, 0xc1, 0x04, 0x30, 0x6d, 0xe8, 0x00, 0x82, 0x2e, 0x30, 0x00, 0x0b, 0x50, 0x8d,
+  0xef, 0x56, 0xc2, 0x2c, 0x52, 0xdf, 0x98, 0x51, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x1f, 0x5e, 0xd5, 0x01, 0xf6, 0x15, 0xe1, 0x1f, 0x00, 0x0d, 0x31, 0xf0, 0x00, 0xe3,
+  0x1f, 0x41, 0x6d, 0x01, 0xd8, 0xec, 0x30, 0x05, 0xde, 0xa1, 0x3e, 0x41, 0x41, 0x79, 0x00, 0x00,
+  0x79, 0x00, 0x00, 0x3e, 0x31, 0x52, 0x06, 0xde, 0xa1, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x4c, 0x00,
+  0x00, 0x4c, 0x06, 0xdd, 0x9c, 0x3e, 0x31, 0x8c, 0x79, 0x00, 0x4c, 0x89, 0x00, 0x4c, 0x4d, 0x21,
+  0x9c, 0x09, 0xec, 0x5c, 0x06, 0xde, 0xa1, 0x3c, 0x20, 0x78, 0x7f, 0xff, 0xfb, 0x79, 0x00, 0x00,
+  0x3e, 0x40, 0x34, 0x05, 0xdf, 0xc3, 0x05, 0xdd, 0x0d, 0x50, 0xcf, 0xfe, 0x0d, 0x30, 0x0d, 0x30,
+  0x0d, 0x30, 0x0d, 0x30, 0x0d, 0x30, 0x08, 0xef, 0xfe, 0x4c, 0x12, 0xe3, 0x3c, 0x12, 0xe2, 0x0b,
+  0xee, 0x70, 0x2d, 0x10, 0x00, 0x1d, 0xef, 0xe6, 0x97, 0x01, 0x8a, 0x4c, 0xee, 0xb2, 0x2e, 0x00,
+  0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x6e, 0xd4, 0x2f, 0x61, 0x7c, 0x2e, 0x00, 0x2e,
+  0x2e, 0x00, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x00, 0x2e, 0x1e, 0x20, 0x00, 0x00, 0x00, 0xf1, 0x0f,
+  0x10, 0xf1, 0x0f, 0x10, 0xf1, 0x0f, 0x10, 0x1e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x0f,
+  0x10, 0x0f, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x0f, 0x10, 0x2f, 0x04, 0xe8, 0x01, 0xf0, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x01, 0xb6, 0x01, 0xf2, 0xc5, 0x00, 0x1f, 0xf9,
+  0x00, 0x01, 0xf2, 0xe4, 0x00, 0x1f, 0x04, 0xd1, 0x01, 0xf0, 0x07, 0xb0, 0xf1, 0xf1, 0xf1, 0xf1,
+  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x2c, 0x7e, 0x94, 0xde, 0x60, 0x2f, 0x51, 0xcb, 0x14, 0xe0, 0x2e,
+  0x00, 0x88, 0x00, 0xe2, 0x2e, 0x00, 0x88, 0x00, 0xe2, 0x2e, 0x00, 0x88, 0x00, 0xe2, 0x2e, 0x00,
+  0x88, 0x00, 0xe2, 0x2c, 0x6e, 0xd4, 0x2f, 0x61, 0x7c, 0x2e, 0x00, 0x2e, 0x2e, 0x00, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x00, 0x2e, 0x05, 0xde, 0xb2, 0x03, 0xe3, 0x17, 0xd0, 0x79, 0x00, 0x0e, 0x27,
+  0x90, 0x00, 0xe2, 0x3e, 0x31, 0x7d, 0x00, 0x5d, 0xeb, 0x20, 0x2c, 0x6e, 0xd4, 0x02, 0xf6, 0x16,
+  0xe0, 0x2e, 0x00, 0x0e, 0x32, 0xe0, 0x00, 0xe2, 0x2f, 0x41, 0x7d, 0x02, 0xe9, 0xec, 0x30, 0x2e,
+  0x00, 0x00, 0x02, 0xe0, 0x00, 0x00, 0x06, 0xde, 0x7c, 0x3e, 0x31, 0x8c, 0x79, 0x00, 0x4c, 0x89,
+  0x00, 0x4c, 0x4d, 0x21, 0xac, 0x09, 0xec, 0x7c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x4c, 0x2c, 0x7e,
+  0x72, 0xf7, 0x00, 0x2e, 0x00, 0x02, 0xe0, 0x00, 0x2e, 0x00, 0x02, 0xe0, 0x00, 0x1b, 0xec, 0x36,
+  0xb1, 0x22, 0x2b, 0x62, 0x00, 0x03, 0xb6, 0x33, 0x08, 0x93, 0xcf, 0xc2, 0x08, 0x40, 0x00, 0xa4,
+  0x00, 0xaf, 0xff, 0x00, 0xc4, 0x00, 0x0c, 0x40, 0x00, 0xc4, 0x00, 0x0b, 0x62, 0x00, 0x6e, 0xc1,
+  0x4c, 0x00, 0x4c, 0x4c, 0x00, 0x4c, 0x4c, 0x00, 0x4c, 0x4c, 0x00, 0x4c, 0x2e, 0x21, 0xac, 0x08,
+  0xed, 0x5c, 0xa6, 0x00, 0x3c, 0x4c, 0x00, 0xa6, 0x0d, 0x31, 0xe1, 0x07, 0x97, 0x90, 0x01, 0xec,
+  0x30, 0x00, 0x9b, 0x00, 0xb5, 0x01, 0xe4, 0x01, 0xe0, 0x7a, 0x05, 0xd9, 0x06, 0x90, 0x2e, 0x0a,
+  0x4d, 0x0b, 0x40, 0x0c, 0x4d, 0x0a, 0x4e, 0x00, 0x07, 0xc8, 0x05, 0xc9, 0x00, 0x02, 0xf3, 0x01,
+  0xe5, 0x00, 0x6c, 0x00, 0xa6, 0x0b, 0x76, 0xb0, 0x01, 0xdd, 0x10, 0x02, 0xdd, 0x30, 0x0c, 0x55,
+  0xc0, 0x79, 0x00, 0xa8, 0xb7, 0x00, 0x3c, 0x4d, 0x00, 0xa6, 0x0c, 0x51, 0xd0, 0x05, 0xb7, 0x80,
+  0x00, 0xdd, 0x10, 0x00, 0x8a, 0x00, 0x00, 0xc3, 0x00, 0x04, 0xb0, 0x00, 0x6f, 0xff, 0xf1, 0x00,
+  0x08, 0x70, 0x00, 0x5a, 0x00, 0x02, 0xc1, 0x00, 0x1c, 0x20, 0x00, 0x8f, 0xff, 0xf0, 0x09, 0xe1,
+  0x2d, 0x10, 0x2b, 0x00, 0x0d, 0x00, 0x2e, 0x00, 0xb8, 0x00, 0x2e, 0x00, 0x0d, 0x00, 0x2b, 0x00,
+  0x2d, 0x10, 0x09, 0xe1, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x7d,
+  0x40, 0x05, 0xb0, 0x02, 0xb0, 0x05, 0x90, 0x05, 0xa0, 0x01, 0xd5, 0x05, 0xa0, 0x05, 0x90, 0x02,
+  0xb0, 0x05, 0xb0, 0x7d, 0x40, 0x09, 0xe8, 0x1c, 0x32, 0xc1, 0x8e, 0xa0, 0x24, 0x00, 0x00, 0x00,
+};
+
+const bitmap::alpha_font_t lato_12 {
+  15, // height
+  32, // first
+  95, // count
+  0, // kerning_count
+  lato_12_glyphs,
+  nullptr,
+  lato_12_data
+};
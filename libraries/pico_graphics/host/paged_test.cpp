@@ -0,0 +1,61 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "libraries/pico_graphics/pico_graphics.hpp"
+
+using namespace pimoroni;
+
+/*
+  Checks the dirty column ranges of the paged 1-bit pen, which live at the
+  end of its framebuffer. Buffers are filled with junk first, as a buffer
+  from the heap or a reused block of memory would be.
+
+  Usage: pico_graphics_paged_test
+*/
+
+static const uint16_t WIDTH = 128;
+static const uint16_t HEIGHT = 60;
+
+static int failures = 0;
+
+// every page's range should be [start, end)
+static void expect_dirty(const char *what, PicoGraphics_Pen1BitPaged &g, uint16_t start, uint16_t end) {
+  for(auto page = 0u; page < g.pages; page++) {
+    if(g.dirty_start[page] != start || g.dirty_end[page] != end) {
+      printf("%s: FAIL page %u is %u-%u, expected %u-%u\n", what, page, g.dirty_start[page], g.dirty_end[page], start, end);
+      failures++;
+      return;
+    }
+  }
+  printf("%s: ok\n", what);
+}
+
+// junk that doesn't repeat, so that no range reads as empty
+static std::vector<uint8_t> junk(size_t size, uint8_t seed) {
+  std::vector<uint8_t> data(size);
+  for(auto i = 0u; i < size; i++) {
+    data[i] = uint8_t(i * 37 + seed);
+  }
+  return data;
+}
+
+int main() {
+  size_t size = PicoGraphics_Pen1BitPaged::buffer_size(WIDTH, HEIGHT);
+  std::vector<uint8_t> buffer = junk(size, 11);
+  PicoGraphics_Pen1BitPaged g(WIDTH, HEIGHT, buffer.data());
+
+  // a new buffer is sent whole, whatever was in it before
+  expect_dirty("construct", g, 0, WIDTH);
+
+  g.clear_dirty();
+  g.set_pen(1);
+  g.rectangle(Rect(10, 0, 20, HEIGHT));
+  expect_dirty("rectangle", g, 10, 30);
+
+  std::vector<uint8_t> other = junk(size, 200);
+  g.set_framebuffer(other.data());
+  expect_dirty("set_framebuffer", g, 0, WIDTH);
+
+  return failures ? 1 : 0;
+}
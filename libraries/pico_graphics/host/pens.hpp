@@ -0,0 +1,67 @@
+#pragma once
+
+#include "libraries/pico_graphics/pico_graphics.hpp"
+
+namespace pimoroni {
+
+  // a pen that only counts the pixels it is asked to draw
+  class PicoGraphics_PenCounter : public PicoGraphics {
+  public:
+    uint64_t pixels = 0;
+
+    PicoGraphics_PenCounter(uint16_t width, uint16_t height)
+    : PicoGraphics(width, height, nullptr) {
+      this->pen_type = PEN_RGB565;
+    }
+    void set_pen(uint c) override {}
+    void set_pen(uint8_t r, uint8_t g, uint8_t b) override {}
+    int create_pen(uint8_t r, uint8_t g, uint8_t b) override {return 0;}
+    void set_pixel(const Point &p) override {pixels++;}
+    void set_pixel_span(const Point &p, uint l) override {pixels += l;}
+    uint get_pixel(const Point &p) override {return 0;}
+    void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override {pixels += l;}
+  };
+
+  static inline uint16_t tiled_pool(uint w, uint h) {
+    const uint t = PicoGraphics_PenRGB565Tiled::TILE_SIZE;
+    return ((w + t - 1) / t) * ((h + t - 1) / t);
+  }
+
+  // every pen type, with the framebuffer supplied by the caller. pens are
+  // never deleted since PicoGraphics has no virtual destructor
+  struct TestPen {
+    const char *name;
+    size_t (*buffer_size)(uint w, uint h);
+    PicoGraphics *(*create)(uint16_t w, uint16_t h, void *buffer);
+  };
+
+  static const TestPen test_pens[] = {
+    {"1BIT",
+      [](uint w, uint h) {return PicoGraphics_Pen1Bit::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_Pen1Bit(w, h, buffer);}},
+    {"1BITY",
+      [](uint w, uint h) {return PicoGraphics_Pen1BitY::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_Pen1BitY(w, h, buffer);}},
+    {"1BIT_PAGED",
+      [](uint w, uint h) {return PicoGraphics_Pen1BitPaged::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_Pen1BitPaged(w, h, buffer);}},
+    {"P4",
+      [](uint w, uint h) {return PicoGraphics_PenP4::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_PenP4(w, h, buffer);}},
+    {"P8",
+      [](uint w, uint h) {return PicoGraphics_PenP8::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_PenP8(w, h, buffer);}},
+    {"RGB332",
+      [](uint w, uint h) {return PicoGraphics_PenRGB332::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_PenRGB332(w, h, buffer);}},
+    {"RGB565",
+      [](uint w, uint h) {return PicoGraphics_PenRGB565::buffer_size(w, h);},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_PenRGB565(w, h, buffer);}},
+    // give the tiled pen enough tiles that it never drops a write, so that
+    // it always matches the RGB565 pen
+    {"RGB565_TILED",
+      [](uint w, uint h) {return PicoGraphics_PenRGB565Tiled::buffer_size(w, h, tiled_pool(w, h));},
+      [](uint16_t w, uint16_t h, void *buffer) -> PicoGraphics * {return new PicoGraphics_PenRGB565Tiled(w, h, buffer, tiled_pool(w, h));}},
+  };
+
+}
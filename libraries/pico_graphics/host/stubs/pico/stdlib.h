@@ -0,0 +1,26 @@
+#pragma once
+
+// A minimal stand-in for the Pico SDK's pico/stdlib.h, just enough for
+// pico_graphics, bitmap_fonts and hershey_fonts to build on a desktop machine
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <time.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+static inline absolute_time_t get_absolute_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (absolute_time_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t) {
+  return (uint32_t)(t / 1000);
+}
+
+static inline uint64_t to_us_since_boot(absolute_time_t t) {
+  return t;
+}
@@ -1,12 +1,16 @@
 add_library(pico_graphics 
     ${CMAKE_CURRENT_LIST_DIR}/types.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_path.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_text_cache.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_1bit.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_1bitY.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_1bit_paged.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_p4.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_p8.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_rgb332.cpp
     ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_rgb565.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/pico_graphics_pen_rgb565_tiled.cpp
 )
 
 target_include_directories(pico_graphics INTERFACE ${CMAKE_CURRENT_LIST_DIR})
@@ -1,3 +1,6 @@
+#include <cmath>
+#include <cstring>
+
 #include "pico_graphics.hpp"
 
 namespace pimoroni {
@@ -5,27 +8,227 @@ namespace pimoroni {
   int PicoGraphics::update_pen(uint8_t i, uint8_t r, uint8_t g, uint8_t b) {return -1;};
   int PicoGraphics::reset_pen(uint8_t i) {return -1;};
   int PicoGraphics::create_pen(uint8_t r, uint8_t g, uint8_t b) {return -1;};
+  uint PicoGraphics::get_pen() {return 0;};
   void PicoGraphics::set_pixel_dither(const Point &p, const RGB &c) {};
   void PicoGraphics::set_pixel_dither(const Point &p, const RGB565 &c) {};
+
+  // pens that can't blend draw anything at least half covered
+  void PicoGraphics::set_pixel_alpha(const Point &p, const uint8_t alpha) {
+    if(alpha >= 128) set_pixel(p);
+  };
   void PicoGraphics::scanline_convert(PenType type, conversion_callback_func callback) {};
+  void PicoGraphics::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {};
+  void PicoGraphics::copy_pixel_rect(const Rect &src, const Point &dest) {};
+  void PicoGraphics::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {};
   void PicoGraphics::sprite(void* data, const Point &sprite, const Point &dest, const int scale, const int transparent) {};
 
+  void PicoGraphics::set_pixel_rect(const Rect &r) {
+    Point dest(r.x, r.y);
+    int32_t h = r.h;
+    while(h--) {
+      // draw span of pixels for this row
+      set_pixel_span(dest, r.w);
+      // move to next scanline
+      dest.y++;
+    }
+  }
+
   void PicoGraphics::set_dimensions(int width, int height) {
     bounds = clip = {0, 0, width, height};
+    clip_depth = 0;
   }
 
   void PicoGraphics::set_framebuffer(void *frame_buffer) {
     this->frame_buffer = frame_buffer;
   }
 
+  void PicoGraphics::copy_bits(const uint8_t *src, uint offset, uint count, uint8_t *dest) {
+    src += offset / 8;
+    uint shift = offset & 0b111;
+    uint bytes = (count + 7) / 8;
+    uint src_bytes = (shift + count + 7) / 8;
+
+    for(auto i = 0u; i < bytes; i++) {
+      uint8_t b = src[i] << shift;
+      if(shift && i + 1 < src_bytes) b |= src[i + 1] >> (8 - shift);
+      dest[i] = b;
+    }
+
+    if(count & 0b111) {
+      dest[bytes - 1] &= 0xff << (8 - (count & 0b111));
+    }
+  }
+
+  void PicoGraphics::paste_bits(const uint8_t *src, uint8_t *dest, uint offset, uint count) {
+    dest += offset / 8;
+    uint shift = offset & 0b111;
+
+    for(auto i = 0u; count > 0; i++) {
+      uint n = std::min(count, 8u);
+      uint8_t mask = 0xff << (8 - n);
+      uint8_t b = src[i] & mask;
+
+      // each byte of src straddles up to two bytes of dest
+      dest[i] = (dest[i] & ~(mask >> shift)) | (b >> shift);
+      uint8_t spill = mask << (8 - shift);
+      if(shift && spill) {
+        dest[i + 1] = (dest[i + 1] & ~spill) | uint8_t(b << (8 - shift));
+      }
+
+      count -= n;
+    }
+  }
+
+  size_t PicoGraphics::row_size(PenType type, uint w) {
+    switch(type) {
+      case PEN_1BIT:
+      case PEN_1BIT_PAGED:
+        return (w + 7) / 8;
+      case PEN_P2:
+        return (w + 3) / 4;
+      case PEN_P4:
+        return (w + 1) / 2;
+      case PEN_P8:
+      case PEN_RGB332:
+        return w;
+      case PEN_RGB565:
+      case PEN_RGB565_TILED:
+        return w * sizeof(RGB565);
+      case PEN_RGB888:
+        return w * 3;
+    }
+    return 0;
+  }
+
+  uint8_t PicoGraphics::dither_1bit(const Point &p, const RGB &c) {
+    static const uint8_t _odm[16] = {
+      0,  8,  2, 10,
+      12,  4, 14,  6,
+      3, 11,  1,  9,
+      15,  7, 13,  5
+    };
+
+    uint8_t _dmv = _odm[(p.x & 0b11) | ((p.y & 0b11) << 2)];
+
+    // luminance() weights sum to 100, scale it to 0-16 so that white is
+    // above every threshold and black below every one
+    uint lum = ((c.luminance() / 100) * 17) >> 8;
+
+    return lum > _dmv ? 1 : 0;
+  }
+
+  void PicoGraphics::dither_row_1bit(const Point &p, uint l, const uint8_t *src, uint8_t *dest) {
+    memset(dest, 0, (l + 7) / 8);
+    for(auto i = 0u; i < l; i++) {
+      if(dither_1bit(Point(p.x + i, p.y), RGB(src[0], src[1], src[2]))) {
+        dest[i / 8] |= 0x80 >> (i & 0b111);
+      }
+      src += 3;
+    }
+  }
+
+  uint8_t PicoGraphics::bitmap_scale(float s) {
+    return std::clamp(s, 1.0f, 255.0f);
+  }
+
+  void PicoGraphics::scanline_transform(PenType type, Rotation rotation, uint scale, conversion_callback_func callback, RGB565 *band, uint band_pixels) {
+    if(type != PEN_RGB565 || scale == 0) return;
+
+    bool sideways = rotation == ROTATE_90 || rotation == ROTATE_270;
+    int32_t row_w = sideways ? bounds.h : bounds.w; // unscaled output size
+    int32_t rows = sideways ? bounds.w : bounds.h;
+
+    // widens a row by the scale and sends it once for each repeat
+    uint16_t row_buf[row_w * scale];
+    auto emit = [&](const RGB565 *src) {
+      RGB565 *dest = row_buf;
+      for(auto x = 0; x < row_w; x++) {
+        for(auto i = 0u; i < scale; i++) {
+          *dest++ = src[x];
+        }
+      }
+      for(auto i = 0u; i < scale; i++) {
+        callback(row_buf, row_w * scale * sizeof(RGB565));
+      }
+    };
+
+    if(rotation == ROTATE_0) {
+      scanline_convert(type, bounds, [&](void *data, size_t length) {
+        emit((const RGB565 *)data);
+      });
+      return;
+    }
+
+    // the other rotations need pixels from rows that come later in the
+    // framebuffer, so the output is gathered a band of rows at a time from
+    // the part of the framebuffer that makes up that band
+    RGB565 local[band == nullptr ? TRANSFORM_BAND_PIXELS : 1];
+    if(band == nullptr) {
+      band = local;
+      band_pixels = TRANSFORM_BAND_PIXELS;
+    }
+    int32_t band_rows = std::min(rows, int32_t(band_pixels / row_w));
+    if(band_rows == 0) return;
+
+    for(int32_t first = 0; first < rows; first += band_rows) {
+      int32_t count = std::min(band_rows, rows - first);
+      Rect region;
+      if(rotation == ROTATE_180) {
+        region = Rect(0, bounds.h - first - count, bounds.w, count);
+      } else if(rotation == ROTATE_90) {
+        region = Rect(first, 0, count, bounds.h);
+      } else {
+        region = Rect(bounds.w - first - count, 0, count, bounds.h);
+      }
+
+      int32_t y = 0;
+      scanline_convert(type, region, [&](void *data, size_t length) {
+        const RGB565 *src = (const RGB565 *)data;
+        if(rotation == ROTATE_180) {
+          // output row r is source row h - 1 - r backwards
+          RGB565 *dest = &band[(count - 1 - y) * row_w];
+          for(auto x = 0; x < bounds.w; x++) {
+            dest[x] = src[bounds.w - 1 - x];
+          }
+        } else if(rotation == ROTATE_90) {
+          // output row r is source column r from the bottom up
+          for(auto r = 0; r < count; r++) {
+            band[r * row_w + bounds.h - 1 - y] = src[r];
+          }
+        } else {
+          // output row r is source column w - 1 - r from the top down
+          for(auto r = 0; r < count; r++) {
+            band[r * row_w + y] = src[count - 1 - r];
+          }
+        }
+        y++;
+      });
+
+      // the pen can't convert to this type
+      if(y != region.h) return;
+
+      for(auto r = 0; r < count; r++) {
+        emit(&band[r * row_w]);
+      }
+    }
+  }
+
   void PicoGraphics::set_font(const bitmap::font_t *font){
     this->bitmap_font = font;
     this->hershey_font = nullptr;
+    this->alpha_font = nullptr;
   }
 
   void PicoGraphics::set_font(const hershey::font_t *font){
     this->bitmap_font = nullptr;
     this->hershey_font = font;
+    this->alpha_font = nullptr;
+  }
+
+  void PicoGraphics::set_font(const bitmap::alpha_font_t *font){
+    this->bitmap_font = nullptr;
+    this->hershey_font = nullptr;
+    this->alpha_font = font;
   }
 
   void PicoGraphics::set_font(std::string name){
@@ -50,6 +253,20 @@ namespace pimoroni {
   void PicoGraphics::remove_clip() {
     clip = bounds;
   }
+
+  bool PicoGraphics::push_clip(const Rect &r) {
+    // pushes beyond the maximum depth leave the clip alone and must not be
+    // popped
+    if(clip_depth >= MAX_CLIP_DEPTH) return false;
+    clip_stack[clip_depth++] = clip;
+    clip = clip.intersection(r);
+    return true;
+  }
+
+  void PicoGraphics::pop_clip() {
+    if(clip_depth == 0) return;
+    clip = clip_stack[--clip_depth];
+  }
   
   void PicoGraphics::clear() {
     rectangle(clip);
@@ -69,6 +286,7 @@ namespace pimoroni {
     Point clipped = p;
     if(clipped.x     <  clip.x)           {l += clipped.x - clip.x; clipped.x = clip.x;}
     if(clipped.x + l >= clip.x + clip.w)  {l  = clip.x + clip.w - clipped.x;}
+    if(l <= 0) return;
 
     Point dest(clipped.x, clipped.y);
     set_pixel_span(dest, l);
@@ -80,19 +298,62 @@ namespace pimoroni {
 
     if(clipped.empty()) return;
 
-    Point dest(clipped.x, clipped.y);
-    while(clipped.h--) {
-      // draw span of pixels for this row
-      set_pixel_span(dest, clipped.w);
-      // move to next scanline
-      dest.y++;
+    set_pixel_rect(clipped);
+  }
+
+  void PicoGraphics::copy_rect(const Rect &src, const Point &dest) {
+    // only copy pixels that come from the framebuffer and land in the clip
+    Rect s = src.intersection(bounds);
+    int32_t ox = dest.x - src.x;
+    int32_t oy = dest.y - src.y;
+    Rect d = Rect(s.x + ox, s.y + oy, s.w, s.h).intersection(clip);
+    if(d.empty()) return;
+
+    copy_pixel_rect(Rect(d.x - ox, d.y - oy, d.w, d.h), Point(d.x, d.y));
+  }
+
+  void PicoGraphics::write_pixels(const Rect &r, const void *src, PenType src_format) {
+    Rect clipped = r.intersection(clip);
+    if(clipped.empty()) return;
+
+    // rows of the source are packed, with sub-byte formats padded to a byte
+    size_t stride = row_size(src_format, r.w);
+    const uint8_t *row = (const uint8_t *)src + (clipped.y - r.y) * stride;
+    for(auto y = clipped.y; y < clipped.y + clipped.h; y++) {
+      set_pixel_row(Point(clipped.x, y), clipped.w, row, clipped.x - r.x, src_format);
+      row += stride;
     }
   }
 
+  void PicoGraphics::scroll(const Rect &r, int32_t dx, int32_t dy, int fill) {
+    int32_t adx = std::abs(dx);
+    int32_t ady = std::abs(dy);
+
+    if(adx < r.w && ady < r.h) {
+      copy_rect(
+        Rect(r.x + std::max(-dx, 0), r.y + std::max(-dy, 0), r.w - adx, r.h - ady),
+        Point(r.x + std::max(dx, 0), r.y + std::max(dy, 0))
+      );
+    }
+
+    if(fill < 0) return;
+
+    // fill the strips that were scrolled into view
+    uint saved = get_pen();
+    set_pen(fill);
+    adx = std::min(adx, r.w);
+    ady = std::min(ady, r.h);
+    if(dx > 0) rectangle(Rect(r.x, r.y, adx, r.h));
+    if(dx < 0) rectangle(Rect(r.x + r.w - adx, r.y, adx, r.h));
+    if(dy > 0) rectangle(Rect(r.x, r.y, r.w, ady));
+    if(dy < 0) rectangle(Rect(r.x, r.y + r.h - ady, r.w, ady));
+    set_pen(saved);
+  }
+
   void PicoGraphics::circle(const Point &p, int32_t radius) {
     // circle in screen bounds?
-    Rect bounds = Rect(p.x - radius, p.y - radius, radius * 2, radius * 2);
-    if(!bounds.intersects(clip)) return;
+    Rect bounds = Rect(p.x - radius, p.y - radius, radius * 2 + 1, radius * 2 + 1);
+    if(radius < 0 || !bounds.intersects(clip)) return;
 
     int ox = radius, oy = 0, err = -radius;
     while (ox >= oy)
@@ -117,11 +378,363 @@ namespace pimoroni {
     }
   }
 
+  // walks one quadrant of an ellipse with the midpoint algorithm, starting on
+  // the horizontal axis, and calls row(y, outer, inner) once for each row where
+  // outer is the half width of the row and inner is the half width of the
+  // innermost pixel needed to keep a one pixel outline connected
+  template<typename F>
+  static void ellipse_rows(int32_t rx, int32_t ry, F row) {
+    int64_t aa = (int64_t)rx * rx, bb = (int64_t)ry * ry;
+    int64_t x = -rx, y = 0;
+    int64_t err = x * (2 * bb + x) + bb;
+
+    int32_t outer = rx, inner = rx;
+    bool pending = false;
+    do {
+      inner = -x;
+      pending = true;
+      int64_t e2 = 2 * err;
+      if(e2 >= (x * 2 + 1) * bb) {x++; err += (x * 2 + 1) * bb;}
+      if(e2 <= (y * 2 + 1) * aa) {
+        row(y, outer, inner);
+        y++; err += (y * 2 + 1) * aa;
+        outer = -x;
+        pending = false;
+      }
+    } while(x <= 0);
+
+    if(pending) {
+      row(y, outer, inner);
+      y++;
+    }
+
+    // very flat ellipses can stop short of the top
+    while(y <= ry) {
+      row(y, 0, 0);
+      y++;
+    }
+  }
+
+  static int32_t isqrt(int32_t v) {
+    if(v <= 0) return 0;
+    int32_t s = int32_t(sqrtf(float(v)));
+    while(s * s > v) s--;
+    while((s + 1) * (s + 1) <= v) s++;
+    return s;
+  }
+
+  void PicoGraphics::circle_outline(const Point &p, int32_t radius) {
+    ellipse_outline(p, radius, radius);
+  }
+
+  void PicoGraphics::ellipse(const Point &p, int32_t rx, int32_t ry) {
+    // ellipse in screen bounds?
+    Rect bounds = Rect(p.x - rx, p.y - ry, rx * 2 + 1, ry * 2 + 1);
+    if(rx < 0 || ry < 0 || !bounds.intersects(clip)) return;
+
+    ellipse_rows(rx, ry, [&](int32_t y, int32_t outer, int32_t inner) {
+      pixel_span(Point(p.x - outer, p.y + y), outer * 2 + 1);
+      if(y != 0) {
+        pixel_span(Point(p.x - outer, p.y - y), outer * 2 + 1);
+      }
+    });
+  }
+
+  void PicoGraphics::ellipse_outline(const Point &p, int32_t rx, int32_t ry) {
+    // ellipse in screen bounds?
+    Rect bounds = Rect(p.x - rx, p.y - ry, rx * 2 + 1, ry * 2 + 1);
+    if(rx < 0 || ry < 0 || !bounds.intersects(clip)) return;
+
+    ellipse_rows(rx, ry, [&](int32_t y, int32_t outer, int32_t inner) {
+      for(int32_t oy : {y, -y}) {
+        if(inner == 0) {
+          pixel_span(Point(p.x - outer, p.y + oy), outer * 2 + 1);
+        } else {
+          pixel_span(Point(p.x - outer, p.y + oy), outer - inner + 1);
+          pixel_span(Point(p.x + inner, p.y + oy), outer - inner + 1);
+        }
+        if(y == 0) break;
+      }
+    });
+  }
+
+  void PicoGraphics::rounded_rectangle(const Rect &r, int32_t radius) {
+    if(r.empty()) return;
+    radius = std::clamp(radius, 0, std::min(r.w, r.h) / 2);
+    if(radius == 0) {
+      rectangle(r);
+      return;
+    }
+
+    Rect clipped = r.intersection(clip);
+    if(clipped.empty()) return;
+
+    // straight sided middle section in one go
+    rectangle(Rect(r.x, r.y + radius, r.w, r.h - radius * 2));
+
+    // the top and bottom bands are inset by the corner curves
+    int32_t straight = r.w - radius * 2;
+    int32_t top = r.y + radius;
+    int32_t bottom = r.y + r.h - 1 - radius;
+    ellipse_rows(radius, radius, [&](int32_t y, int32_t outer, int32_t inner) {
+      if(y == 0) return;
+      pixel_span(Point(r.x + radius - outer, top - y), straight + outer * 2);
+      pixel_span(Point(r.x + radius - outer, bottom + y), straight + outer * 2);
+    });
+  }
+
+  void PicoGraphics::arc(const Point &p, int32_t radius, int32_t thickness, float start, float end) {
+    // arc in screen bounds?
+    Rect bounds = Rect(p.x - radius, p.y - radius, radius * 2 + 1, radius * 2 + 1);
+    if(radius < 0 || thickness <= 0 || !bounds.intersects(clip)) return;
+
+    // angles are in degrees clockwise from three o'clock, the sector test
+    // uses 10 bit fixed point direction vectors and cross products
+    bool full = fabsf(end - start) >= 360.0f;
+    float sweep = fmodf(end - start, 360.0f);
+    if(sweep < 0.0f) sweep += 360.0f;
+    bool wide = sweep > 180.0f;
+    float a0 = start * (float)M_PI / 180.0f;
+    float a1 = end * (float)M_PI / 180.0f;
+    int32_t sx = int32_t(cosf(a0) * 1024.0f), sy = int32_t(sinf(a0) * 1024.0f);
+    int32_t ex = int32_t(cosf(a1) * 1024.0f), ey = int32_t(sinf(a1) * 1024.0f);
+
+    auto inside = [&](int32_t x, int32_t y) {
+      bool after_start = sx * y - sy * x >= 0;
+      bool before_end = x * ey - y * ex >= 0;
+      return wide ? (after_start || before_end) : (after_start && before_end);
+    };
+
+    // emits the parts of a row segment that fall within the sector
+    auto segment = [&](int32_t y, int32_t x1, int32_t x2) {
+      x1 = std::max(x1, clip.x - p.x);
+      x2 = std::min(x2, clip.x + clip.w - 1 - p.x);
+      if(full) {
+        if(x1 <= x2) pixel_span(Point(p.x + x1, p.y + y), x2 - x1 + 1);
+        return;
+      }
+      int32_t run = x1;
+      for(int32_t x = x1; x <= x2; x++) {
+        if(!inside(x, y)) {
+          if(x > run) pixel_span(Point(p.x + run, p.y + y), x - run);
+          run = x + 1;
+        }
+      }
+      if(x2 >= run) pixel_span(Point(p.x + run, p.y + y), x2 - run + 1);
+    };
+
+    // ring covers pixels whose centres lie between the inner and outer
+    // radius, padded by half a pixel either side
+    int32_t inner = radius - thickness + 1;
+    int32_t y1 = std::max(-radius, clip.y - p.y);
+    int32_t y2 = std::min(radius, clip.y + clip.h - 1 - p.y);
+    for(int32_t y = y1; y <= y2; y++) {
+      int32_t wo = isqrt(radius * radius + radius - y * y);
+      int32_t h = inner * inner - inner - y * y;
+      if(inner > 0 && h >= 0) {
+        int32_t wi = isqrt(h);
+        segment(y, -wo, -wi - 1);
+        segment(y, wi + 1, wo);
+      } else {
+        segment(y, -wo, wo);
+      }
+    }
+  }
+
+  // takes a row of gradient colours one pixel at a time. RGB565 pens don't
+  // dither, so runs of the same colour are written as a single span in that
+  // colour, other pens get each pixel through set_pixel_dither
+  class GradientRow {
+    public:
+      GradientRow(PicoGraphics *g) : g(g) {
+        if(g->pen_type == PicoGraphics::PEN_RGB565) {
+          pen = &((PicoGraphics_PenRGB565 *)g)->color;
+        } else if(g->pen_type == PicoGraphics::PEN_RGB565_TILED) {
+          pen = &((PicoGraphics_PenRGB565Tiled *)g)->color;
+        }
+      }
+
+      void add(const Point &p, const RGB &c) {
+        if(pen == nullptr) {
+          g->set_pixel_dither(p, c);
+          return;
+        }
+        RGB565 c565 = RGB(c).to_rgb565();
+        if(run > 0 && (c565 != run_color || p.y != start.y || p.x != start.x + int32_t(run))) {
+          flush();
+        }
+        if(run == 0) {
+          start = p;
+          run_color = c565;
+        }
+        run++;
+      }
+
+      void flush() {
+        if(run == 0) return;
+        RGB565 saved = *pen;
+        *pen = run_color;
+        g->set_pixel_span(start, run);
+        *pen = saved;
+        run = 0;
+      }
+
+    private:
+      PicoGraphics *g;
+      RGB565 *pen = nullptr;
+      RGB565 run_color = 0;
+      Point start;
+      uint run = 0;
+  };
+
+  // steps a colour across a span in 16:16 fixed point
+  static void gradient_span(GradientRow &row, Point p, int32_t l, int32_t r, int32_t gr, int32_t b, int32_t dr, int32_t dg, int32_t db) {
+    while(l--) {
+      row.add(p, RGB(
+        (uint8_t)std::clamp(r  >> 16, 0, 255),
+        (uint8_t)std::clamp(gr >> 16, 0, 255),
+        (uint8_t)std::clamp(b  >> 16, 0, 255)));
+      r += dr; gr += dg; b += db;
+      p.x++;
+    }
+    row.flush();
+  }
+
+  void PicoGraphics::linear_gradient(const Rect &r, const RGB &c0, const RGB &c1, float a) {
+    Rect clipped = r.intersection(clip);
+    if(clipped.empty()) return;
+
+    // project pixels onto the gradient direction, scaled so that the
+    // corners of the rectangle map onto 0.0 and 1.0
+    float rad = a * (float)M_PI / 180.0f;
+    float dx = cosf(rad);
+    float dy = sinf(rad);
+    float extent = fabsf(dx) * (r.w - 1) + fabsf(dy) * (r.h - 1);
+    if(extent > 0.0f) {dx /= extent; dy /= extent;}
+    float t0 = (dx < 0.0f ? -dx * (r.w - 1) : 0.0f) + (dy < 0.0f ? -dy * (r.h - 1) : 0.0f);
+
+    // per channel colour change for one pixel in x and y, 16:16 fixed point
+    float d_r = c1.r - c0.r, d_g = c1.g - c0.g, d_b = c1.b - c0.b;
+    int32_t drx = int32_t(d_r * dx * 65536.0f), dry = int32_t(d_r * dy * 65536.0f);
+    int32_t dgx = int32_t(d_g * dx * 65536.0f), dgy = int32_t(d_g * dy * 65536.0f);
+    int32_t dbx = int32_t(d_b * dx * 65536.0f), dby = int32_t(d_b * dy * 65536.0f);
+
+    // colour at the top left of the clipped area (+0.5 to round)
+    float t = t0 + dx * (clipped.x - r.x) + dy * (clipped.y - r.y);
+    int32_t cr = int32_t((c0.r + d_r * t + 0.5f) * 65536.0f);
+    int32_t cg = int32_t((c0.g + d_g * t + 0.5f) * 65536.0f);
+    int32_t cb = int32_t((c0.b + d_b * t + 0.5f) * 65536.0f);
+
+    // dithering pens set the pen for every pixel
+    uint saved = get_pen();
+    GradientRow row(this);
+    Point dest(clipped.x, clipped.y);
+    for(int32_t y = 0; y < clipped.h; y++) {
+      gradient_span(row, dest, clipped.w, cr, cg, cb, drx, dgx, dbx);
+      cr += dry; cg += dgy; cb += dby;
+      dest.y++;
+    }
+    set_pen(saved);
+  }
+
+  void PicoGraphics::radial_gradient(const Point &p, int32_t radius, const RGB &c0, const RGB &c1) {
+    Rect bounds = Rect(p.x - radius, p.y - radius, radius * 2 + 1, radius * 2 + 1);
+    if(!bounds.intersects(clip) || radius <= 0) return;
+
+    // distances are tracked with four fractional bits, colour change per
+    // 1/16th of a pixel from the centre is in 16:16 fixed point
+    int32_t dr = (c1.r - c0.r) * 65536 / (radius * 16);
+    int32_t dg = (c1.g - c0.g) * 65536 / (radius * 16);
+    int32_t db = (c1.b - c0.b) * 65536 / (radius * 16);
+
+    int32_t y1 = std::max(p.y - radius, clip.y);
+    int32_t y2 = std::min(p.y + radius, clip.y + clip.h - 1);
+
+    uint saved = get_pen();
+    GradientRow row(this);
+    for(int32_t y = y1; y <= y2; y++) {
+      int32_t oy = y - p.y;
+      int32_t half = int32_t(sqrtf(float(radius * radius - oy * oy)));
+      int32_t x1 = std::max(p.x - half, clip.x);
+      int32_t x2 = std::min(p.x + half, clip.x + clip.w - 1);
+      if(x1 > x2) continue;
+
+      // squared distance (scaled by 256) and its integer square root, both
+      // stepped incrementally across the row
+      int32_t ox = x1 - p.x;
+      int32_t d2 = (ox * ox + oy * oy) * 256;
+      int32_t s = int32_t(sqrtf(float(d2)));
+
+      Point dest(x1, y);
+      for(int32_t x = x1; x <= x2; x++) {
+        while((s + 1) * (s + 1) <= d2) s++;
+        while(s * s > d2) s--;
+
+        row.add(dest, RGB(
+          (uint8_t)std::clamp(c0.r + ((s * dr + 0x8000) >> 16), 0, 255),
+          (uint8_t)std::clamp(c0.g + ((s * dg + 0x8000) >> 16), 0, 255),
+          (uint8_t)std::clamp(c0.b + ((s * db + 0x8000) >> 16), 0, 255)));
+
+        d2 += (2 * ox + 1) * 256;
+        ox++;
+        dest.x++;
+      }
+      row.flush();
+    }
+    set_pen(saved);
+  }
+
+  // draws a run of pixels from an anti-aliased font, solid runs go straight
+  // to the pen as a span and the edges are blended
+  static void alpha_span(PicoGraphics *g, const Point &p, int32_t l, uint8_t alpha) {
+    if(alpha == 255) {
+      g->pixel_span(p, l);
+      return;
+    }
+
+    if(p.y < g->clip.y || p.y >= g->clip.y + g->clip.h) return;
+    int32_t x1 = std::max(p.x, g->clip.x);
+    int32_t x2 = std::min(p.x + l, g->clip.x + g->clip.w);
+    for(int32_t x = x1; x < x2; x++) {
+      g->set_pixel_alpha(Point(x, p.y), alpha);
+    }
+  }
+
+  // conservative screen area covered by a run of text width pixels wide,
+  // used to skip runs that fall entirely outside of the clip
+  static Rect text_bounds(PicoGraphics *g, int32_t width, const Point &p, bool wrapped, float s) {
+    if (g->alpha_font) {
+      // glyphs can overhang their advance and the line a little
+      int32_t h = g->alpha_font->height;
+      return Rect(p.x - h, p.y - h, width + h * 2, wrapped ? INT32_MAX / 2 : h * 3);
+    }
+
+    if (g->bitmap_font) {
+      // glyphs (with accents) are plotted from 8 rows above the origin on
+      // a 32 row canvas. lines are never longer than the whole run but
+      // wrapped text can extend any distance downwards
+      int32_t scale = PicoGraphics::bitmap_scale(s);
+      int32_t height = wrapped ? INT32_MAX / 2 : 32 * scale;
+      return Rect(p.x, p.y - 8 * scale, width, height);
+    }
+
+    // hershey glyph vertices all fall within 33 units of the glyph origin
+    // and the text can be rotated to any angle around p
+    int32_t radius = width + int32_t(48.0f * s) + 1;
+    return Rect(p.x - radius, p.y - radius, radius * 2 + 1, radius * 2 + 1);
+  }
+
   void PicoGraphics::character(const char c, const Point &p, float s, float a) {
+    int32_t width = 0;
+    if (bitmap_font) width = bitmap::measure_character(bitmap_font, c, bitmap_scale(s));
+    if (hershey_font) width = hershey::measure_glyph(hershey_font, c, s);
+    if (alpha_font) width = bitmap::measure_character(alpha_font, c);
+    if (!text_bounds(this, width, p, false, s).intersects(clip)) return;
+
     if (bitmap_font) {
       bitmap::character(bitmap_font, [this](int32_t x, int32_t y, int32_t w, int32_t h) {
         rectangle(Rect(x, y, w, h));
-      }, c, p.x, p.y, std::max(1.0f, s));
+      }, c, p.x, p.y, bitmap_scale(s));
       return;
     }
 
@@ -131,13 +744,27 @@ namespace pimoroni {
       }, c, p.x, p.y, s, a);
       return;
     }
+
+    if (alpha_font) {
+      bitmap::character(alpha_font, [this](int32_t x, int32_t y, int32_t l, uint8_t alpha) {
+        alpha_span(this, Point(x, y), l, alpha);
+      }, c, p.x, p.y);
+      return;
+    }
   }
 
   void PicoGraphics::text(const std::string &t, const Point &p, int32_t wrap, float s, float a, uint8_t letter_spacing) {
+    // text starting inside the clip is always drawn, so it only needs to be
+    // measured when it starts outside
+    if (!clip.contains(p)) {
+      int32_t width = measure_text(t, s, letter_spacing);
+      if (!text_bounds(this, width, p, width > wrap, s).intersects(clip)) return;
+    }
+
     if (bitmap_font) {
       bitmap::text(bitmap_font, [this](int32_t x, int32_t y, int32_t w, int32_t h) {
         rectangle(Rect(x, y, w, h));
-      }, t, p.x, p.y, wrap, std::max(1.0f, s), letter_spacing);
+      }, t, p.x, p.y, wrap, bitmap_scale(s), letter_spacing);
       return;
     }
 
@@ -147,11 +774,19 @@ namespace pimoroni {
       }, t, p.x, p.y, s, a);
       return;
     }
+
+    if (alpha_font) {
+      bitmap::text(alpha_font, [this](int32_t x, int32_t y, int32_t l, uint8_t alpha) {
+        alpha_span(this, Point(x, y), l, alpha);
+      }, t, p.x, p.y, wrap);
+      return;
+    }
   }
 
   int32_t PicoGraphics::measure_text(const std::string &t, float s, uint8_t letter_spacing) {
-    if (bitmap_font) return bitmap::measure_text(bitmap_font, t, std::max(1.0f, s), letter_spacing);
+    if (bitmap_font) return bitmap::measure_text(bitmap_font, t, bitmap_scale(s), letter_spacing);
     if (hershey_font) return hershey::measure_text(hershey_font, t, s);
+    if (alpha_font) return bitmap::measure_text(alpha_font, t);
     return 0;
   }
 
@@ -227,13 +862,21 @@ namespace pimoroni {
   void PicoGraphics::polygon(const std::vector<Point> &points) {
     static int32_t nodes[64]; // maximum allowed number of nodes per scanline for polygon rendering
 
+    if (points.empty()) return;
+
+    int32_t minx = points[0].x, maxx = points[0].x;
     int32_t miny = points[0].y, maxy = points[0].y;
 
     for (uint16_t i = 1; i < points.size(); i++) {
+      minx = std::min(minx, points[i].x);
+      maxx = std::max(maxx, points[i].x);
       miny = std::min(miny, points[i].y);
       maxy = std::max(maxy, points[i].y);
     }
 
+    // polygon in screen bounds?
+    if (!Rect(minx, miny, maxx - minx + 1, maxy - miny + 1).intersects(clip)) return;
+
     // for each scanline within the polygon bounds (clipped to clip rect)
     Point p;
 
@@ -249,7 +892,9 @@ namespace pimoroni {
           int32_t ex = points[j].x;
           int32_t px = int32_t(sx + float(fy - sy) / float(ey - sy) * float(ex - sx));
 
-          nodes[n++] = px < clip.x ? clip.x : (px >= clip.x + clip.w ? clip.x + clip.w - 1 : px);// clamp(int32_t(sx + float(fy - sy) / float(ey - sy) * float(ex - sx)), clip.x, clip.x + clip.w);
+          // left unclamped, pixel_span clips each span. clamping here would
+          // turn spans that lie wholly outside the clip into a pixel on its edge
+          nodes[n++] = px;
         }
       }
 
@@ -271,6 +916,12 @@ namespace pimoroni {
   }
 
   void PicoGraphics::line(Point p1, Point p2) {
+    // line in screen bounds?
+    Rect line_bounds(
+      std::min(p1.x, p2.x), std::min(p1.y, p2.y),
+      std::abs(p2.x - p1.x) + 1, std::abs(p2.y - p1.y) + 1);
+    if(line_bounds.intersection(clip).empty()) return;
+
     // fast horizontal line
     if(p1.y == p2.y) {
       p1 = p1.clamp(clip);
@@ -306,9 +957,9 @@ namespace pimoroni {
       // shallow version
       int32_t s = std::abs(dx);       // number of steps
       int32_t sx = dx < 0 ? -1 : 1;   // x step value
-      int32_t sy = (dy << 16) / s;    // y step value in fixed 16:16
+      int32_t sy = dy * 65536 / s;    // y step value in fixed 16:16
       int32_t x = p1.x;
-      int32_t y = p1.y << 16;
+      int32_t y = p1.y * 65536;
       while(s--) {
         Point p(x, y >> 16);
         if(clip.contains(p)) set_pixel(p);
@@ -319,9 +970,9 @@ namespace pimoroni {
       // steep version
       int32_t s = std::abs(dy);       // number of steps
       int32_t sy = dy < 0 ? -1 : 1;   // y step value
-      int32_t sx = (dx << 16) / s;    // x step value in fixed 16:16
+      int32_t sx = dx * 65536 / s;    // x step value in fixed 16:16
       int32_t y = p1.y;
-      int32_t x = p1.x << 16;
+      int32_t x = p1.x * 65536;
       while(s--) {
         Point p(x >> 16, y);
         if(clip.contains(p)) set_pixel(p);
@@ -330,4 +981,77 @@ namespace pimoroni {
       }
     }
   }
+
+  bool PicoGraphics::flood_fill(const Point &p, FillSpan *stack, uint stack_size) {
+    FillSpan local[stack == nullptr ? FLOOD_FILL_STACK : 1];
+    if(stack == nullptr) {
+      stack = local;
+      stack_size = FLOOD_FILL_STACK;
+    }
+    uint count = 0;
+    bool overflow = false;
+
+    if(!clip.contains(p)) return true;
+
+    uint target = get_pixel(p);
+    int32_t min_x = clip.x, max_x = clip.x + clip.w - 1;
+    int32_t min_y = clip.y, max_y = clip.y + clip.h - 1;
+
+    auto push = [&](int32_t y, int32_t x1, int32_t x2, int32_t dy) {
+      if(y + dy < min_y || y + dy > max_y) return;
+      if(count == stack_size) {
+        overflow = true;
+        return;
+      }
+      stack[count++] = {(int16_t)y, (int16_t)x1, (int16_t)x2, (int16_t)dy};
+    };
+
+    // fills a span and confirms that it changed, otherwise the pen matches
+    // the target colour (or the write was dropped) and we would never finish
+    auto fill = [&](int32_t y, int32_t x1, int32_t x2) {
+      set_pixel_span(Point(x1, y), x2 - x1 + 1);
+      return get_pixel(Point(x1, y)) != target;
+    };
+
+    // seed span
+    int32_t l = p.x, r = p.x;
+    while(l > min_x && get_pixel(Point(l - 1, p.y)) == target) l--;
+    while(r < max_x && get_pixel(Point(r + 1, p.y)) == target) r++;
+    if(!fill(p.y, l, r)) return true;
+    push(p.y, l, r, 1);
+    push(p.y, l, r, -1);
+
+    while(count > 0) {
+      FillSpan s = stack[--count];
+      int32_t y = s.y + s.dy;
+
+      int32_t x = s.x1;
+      while(x <= s.x2) {
+        // skip pixels that aren't part of the region
+        while(x <= s.x2 && get_pixel(Point(x, y)) != target) x++;
+        if(x > s.x2) break;
+
+        // only a run that starts at the left of the parent can extend further
+        // left, all of them can extend past the right hand side
+        l = x;
+        if(l == s.x1) {
+          while(l > min_x && get_pixel(Point(l - 1, y)) == target) l--;
+        }
+        r = x;
+        while(r < max_x && get_pixel(Point(r + 1, y)) == target) r++;
+
+        if(!fill(y, l, r)) return false;
+
+        push(y, l, r, s.dy);
+
+        // leaks around the ends of the parent span need checking in reverse
+        if(l < s.x1 - 1) push(y, l, s.x1 - 1, -s.dy);
+        if(r > s.x2 + 1) push(y, s.x2 + 1, r, -s.dy);
+
+        x = r + 2;
+      }
+    }
+
+    return !overflow;
+  }
 }
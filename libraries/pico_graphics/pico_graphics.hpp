@@ -125,6 +125,61 @@ namespace pimoroni {
     void deflate(int32_t v);
   };
 
+  // a vector path made of lines and bezier curves, stored in a compact binary
+  // format so that icons can be drawn directly from flash (see svg-to-path.py)
+  //
+  // header:   'P', flags, width (uint16), height (uint16)
+  // commands: opcode byte followed by the points it needs, either int16
+  //           absolute or (with RELATIVE set) int8 deltas from the previous
+  //           point, in 1/16ths of a pixel, all little endian
+  class Path {
+  public:
+    enum Command : uint8_t {
+      MOVE     = 0,
+      LINE     = 1,
+      QUAD     = 2,
+      CUBIC    = 3,
+      CLOSE    = 4,
+      RELATIVE = 0x80
+    };
+
+    enum Flags : uint8_t {
+      EVEN_ODD = 0b1  // fill using the even-odd rule instead of non-zero
+    };
+
+    static const uint8_t MAGIC = 'P';
+    static const size_t HEADER_SIZE = 6;
+
+    // points are stored as int16 with four fractional bits, adding one
+    // outside this range leaves the path invalid
+    static const int32_t COORD_MIN = -2048;
+    static const int32_t COORD_MAX = 2047;
+
+    Path(uint16_t width = 0, uint16_t height = 0, uint8_t flags = 0);
+    Path(const uint8_t *data, size_t size); // data is used in place, not copied
+
+    void move_to(const Point &p);
+    void line_to(const Point &p);
+    void quad_to(const Point &c, const Point &p);
+    void cubic_to(const Point &c1, const Point &c2, const Point &p);
+    void close();
+
+    bool valid() const;
+    const uint8_t *data() const;
+    size_t size() const;
+    uint16_t width() const;
+    uint16_t height() const;
+    uint8_t flags() const;
+
+  private:
+    std::vector<uint8_t> buffer;
+    const uint8_t *external = nullptr;
+    size_t external_size = 0;
+    bool overflow = false;
+
+    void add(Command c, std::initializer_list<Point> points);
+  };
+
   static const RGB565 rgb332_to_rgb565_lut[256] = {
     0x0000, 0x0800, 0x1000, 0x1800, 0x0001, 0x0801, 0x1001, 0x1801, 0x0002, 0x0802, 0x1002, 0x1802, 0x0003, 0x0803, 0x1003, 0x1803,
     0x0004, 0x0804, 0x1004, 0x1804, 0x0005, 0x0805, 0x1005, 0x1805, 0x0006, 0x0806, 0x1006, 0x1806, 0x0007, 0x0807, 0x1007, 0x1807,
@@ -152,7 +207,10 @@ namespace pimoroni {
       PEN_P4,
       PEN_P8,
       PEN_RGB332,
-      PEN_RGB565
+      PEN_RGB565,
+      PEN_RGB565_TILED,
+      PEN_RGB888,       // source format for write_pixels only, r, g, b bytes
+      PEN_1BIT_PAGED
     };
 
     void *frame_buffer;
@@ -161,6 +219,10 @@ namespace pimoroni {
     Rect bounds;
     Rect clip;
 
+    static const uint MAX_CLIP_DEPTH = 8;
+    Rect clip_stack[MAX_CLIP_DEPTH]; // clips saved by push_clip
+    uint8_t clip_depth = 0;
+
     typedef std::function<void(void *data, size_t length)> conversion_callback_func;
     //typedef std::function<void(int y)> scanline_interrupt_func;
 
@@ -168,6 +230,7 @@ namespace pimoroni {
 
     const bitmap::font_t *bitmap_font;
     const hershey::font_t *hershey_font;
+    const bitmap::alpha_font_t *alpha_font = nullptr;
 
     static constexpr RGB332 rgb_to_rgb332(uint8_t r, uint8_t g, uint8_t b) {
       return RGB(r, g, b).to_rgb332();
@@ -191,6 +254,19 @@ namespace pimoroni {
       return RGB(r, g, b).to_rgb565();
     }
 
+    // blends fg over bg (both byte swapped), alpha is 0 - 255
+    static constexpr RGB565 blend_rgb565(RGB565 bg, RGB565 fg, uint8_t alpha) {
+      // spread the channels out with gaps between them so that all three
+      // can be blended with a single multiply
+      uint32_t a = (alpha + 4) >> 3;
+      uint32_t b = __builtin_bswap16(bg);
+      uint32_t f = __builtin_bswap16(fg);
+      b = (b | (b << 16)) & 0x07e0f81f;
+      f = (f | (f << 16)) & 0x07e0f81f;
+      uint32_t c = (b + (((f - b) * a) >> 5)) & 0x07e0f81f;
+      return __builtin_bswap16(uint16_t(c | (c >> 16)));
+    }
+
     static constexpr RGB rgb332_to_rgb(RGB332 c) {
       return RGB((RGB332)c);
     };
@@ -199,6 +275,26 @@ namespace pimoroni {
       return RGB((RGB565)c);
     };
 
+    // copies count bits starting offset bits into src so that they start on
+    // a byte boundary in dest, any unused bits in the last byte are cleared
+    static void copy_bits(const uint8_t *src, uint offset, uint count, uint8_t *dest);
+
+    // the reverse of copy_bits, writes count bits from the start of src into
+    // dest starting offset bits in, leaving the bits around them untouched
+    static void paste_bits(const uint8_t *src, uint8_t *dest, uint offset, uint count);
+
+    // bytes needed for a row of w pixels in a given format
+    static size_t row_size(PenType type, uint w);
+
+    // ordered dither of a colour to black (0) or white (1) for 1-bit pens
+    static uint8_t dither_1bit(const Point &p, const RGB &c);
+
+    // dithers l RGB888 pixels, the first at p, into a packed 1-bit row
+    static void dither_row_1bit(const Point &p, uint l, const uint8_t *src, uint8_t *dest);
+
+    // whole number scale that bitmap fonts are drawn at for a text scale
+    static uint8_t bitmap_scale(float s);
+
     PicoGraphics(uint16_t width, uint16_t height, void *frame_buffer)
     : frame_buffer(frame_buffer), bounds(0, 0, width, height), clip(0, 0, width, height) {
       set_font(&font6);
@@ -206,41 +302,72 @@ namespace pimoroni {
 
     virtual void set_pen(uint c) = 0;
     virtual void set_pen(uint8_t r, uint8_t g, uint8_t b) = 0;
+    virtual uint get_pen(); // the current pen, as it would be passed to set_pen
     virtual void set_pixel(const Point &p) = 0;
     virtual void set_pixel_span(const Point &p, uint l) = 0;
+    virtual uint get_pixel(const Point &p) = 0;
+    virtual void set_pixel_rect(const Rect &r);
 
     virtual int create_pen(uint8_t r, uint8_t g, uint8_t b);
     virtual int update_pen(uint8_t i, uint8_t r, uint8_t g, uint8_t b);
     virtual int reset_pen(uint8_t i);
     virtual void set_pixel_dither(const Point &p, const RGB &c);
     virtual void set_pixel_dither(const Point &p, const RGB565 &c);
+    virtual void set_pixel_alpha(const Point &p, const uint8_t alpha);
+    virtual void copy_pixel_rect(const Rect &src, const Point &dest);
+    virtual void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format);
     virtual void scanline_convert(PenType type, conversion_callback_func callback);
+    virtual void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback);
+    static const uint TRANSFORM_BAND_PIXELS = 512; // band kept on the call stack when none is provided
+    void scanline_transform(PenType type, Rotation rotation, uint scale, conversion_callback_func callback, RGB565 *band = nullptr, uint band_pixels = 0);
     virtual void sprite(void* data, const Point &sprite, const Point &dest, const int scale, const int transparent);
 
     void set_font(const bitmap::font_t *font);
     void set_font(const hershey::font_t *font);
+    void set_font(const bitmap::alpha_font_t *font);
     void set_font(std::string font);
 
     void set_dimensions(int width, int height);
-    void set_framebuffer(void *frame_buffer);
+    virtual void set_framebuffer(void *frame_buffer);
 
     void *get_data();
     void get_data(PenType type, uint y, void *row_buf);
 
     void set_clip(const Rect &r);
     void remove_clip();
+    bool push_clip(const Rect &r);
+    void pop_clip();
 
     void clear();
     void pixel(const Point &p);
     void pixel_span(const Point &p, int32_t l);
     void rectangle(const Rect &r);
     void circle(const Point &p, int32_t r);
+    void circle_outline(const Point &p, int32_t r);
+    void ellipse(const Point &p, int32_t rx, int32_t ry);
+    void ellipse_outline(const Point &p, int32_t rx, int32_t ry);
+    void rounded_rectangle(const Rect &r, int32_t radius);
+    void arc(const Point &p, int32_t r, int32_t thickness, float start, float end);
+    void linear_gradient(const Rect &r, const RGB &c0, const RGB &c1, float a = 0.0f);
+    void radial_gradient(const Point &p, int32_t r, const RGB &c0, const RGB &c1);
     void character(const char c, const Point &p, float s = 2.0f, float a = 0.0f);
     void text(const std::string &t, const Point &p, int32_t wrap, float s = 2.0f, float a = 0.0f, uint8_t letter_spacing = 1);
     int32_t measure_text(const std::string &t, float s = 2.0f, uint8_t letter_spacing = 1);
     void polygon(const std::vector<Point> &points);
     void triangle(Point p1, Point p2, Point p3);
     void line(Point p1, Point p2);
+    // stack entries for flood_fill, a span that has just been filled and the
+    // direction of the neighbouring row that still needs to be checked
+    struct FillSpan {
+      int16_t y, x1, x2, dy;
+    };
+    static const uint FLOOD_FILL_STACK = 128; // spans kept on the call stack when none are provided
+    bool flood_fill(const Point &p, FillSpan *stack = nullptr, uint stack_size = 0);
+    void copy_rect(const Rect &src, const Point &dest);
+    void write_pixels(const Rect &r, const void *src, PenType src_format);
+    void scroll(const Rect &r, int32_t dx, int32_t dy, int fill = -1);
+    void fill_path(const Path &path, const Point &origin = Point(0, 0), float scale = 1.0f);
+    void stroke_path(const Path &path, int32_t width, const Point &origin = Point(0, 0), float scale = 1.0f);
   };
 
   class PicoGraphics_Pen1Bit : public PicoGraphics {
@@ -250,9 +377,16 @@ namespace pimoroni {
       PicoGraphics_Pen1Bit(uint16_t width, uint16_t height, void *frame_buffer);
       void set_pen(uint c) override;
       void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
 
       void set_pixel(const Point &p) override;
       void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
+      void set_pixel_dither(const Point &p, const RGB &c) override;
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
+      void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
 
       static size_t buffer_size(uint w, uint h) {
           return w * h / 8;
@@ -266,15 +400,61 @@ namespace pimoroni {
       PicoGraphics_Pen1BitY(uint16_t width, uint16_t height, void *frame_buffer);
       void set_pen(uint c) override;
       void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
 
       void set_pixel(const Point &p) override;
       void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
+      void set_pixel_dither(const Point &p, const RGB &c) override;
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
+      void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
 
       static size_t buffer_size(uint w, uint h) {
           return w * h / 8;
       }
   };
 
+  // 1-bit pixels stored the way SH1107 (and SSD1306) OLEDs are written: in
+  // pages of eight rows, one byte per column with the top row in bit 0.
+  // The columns drawn into in each page are tracked so that a driver only
+  // sends what changed. The ranges live at the end of the framebuffer.
+  class PicoGraphics_Pen1BitPaged : public PicoGraphics {
+    public:
+      uint8_t color;
+      uint16_t pages;
+      uint16_t *dirty_start;  // first column changed in each page
+      uint16_t *dirty_end;    // one past the last, equal to start if unchanged
+
+      PicoGraphics_Pen1BitPaged(uint16_t width, uint16_t height, void *frame_buffer);
+      void set_pen(uint c) override;
+      void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
+
+      void set_pixel(const Point &p) override;
+      void set_pixel_span(const Point &p, uint l) override;
+      void set_pixel_rect(const Rect &r) override;
+      uint get_pixel(const Point &p) override;
+      void set_pixel_dither(const Point &p, const RGB &c) override;
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
+      void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
+      void set_framebuffer(void *frame_buffer) override;
+
+      void mark_dirty(const Rect &r);
+      void clear_dirty();
+
+      static size_t page_bytes(uint w, uint h) {
+          // padded so that the dirty ranges are aligned
+          return ((w * ((h + 7) / 8)) + 1) & ~1u;
+      }
+      static size_t buffer_size(uint w, uint h) {
+          return page_bytes(w, h) + ((h + 7) / 8) * 2 * sizeof(uint16_t);
+      }
+  };
+
   class PicoGraphics_PenP4 : public PicoGraphics {
     public:
       static const uint palette_size = 16;
@@ -291,16 +471,22 @@ namespace pimoroni {
       PicoGraphics_PenP4(uint16_t width, uint16_t height, void *frame_buffer);
       void set_pen(uint c) override;
       void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
       int update_pen(uint8_t i, uint8_t r, uint8_t g, uint8_t b) override;
       int create_pen(uint8_t r, uint8_t g, uint8_t b) override;
       int reset_pen(uint8_t i) override;
 
       void set_pixel(const Point &p) override;
       void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
       void get_dither_candidates(const RGB &col, const RGB *palette, size_t len, std::array<uint8_t, 16> &candidates);
+      void build_candidate_cache(); // if the palette has changed since it was last built
       void set_pixel_dither(const Point &p, const RGB &c) override;
 
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
       void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
       static size_t buffer_size(uint w, uint h) {
           return w * h / 2;
       }
@@ -322,16 +508,22 @@ namespace pimoroni {
       PicoGraphics_PenP8(uint16_t width, uint16_t height, void *frame_buffer);
       void set_pen(uint c) override;
       void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
       int update_pen(uint8_t i, uint8_t r, uint8_t g, uint8_t b) override;
       int create_pen(uint8_t r, uint8_t g, uint8_t b) override;
       int reset_pen(uint8_t i) override;
 
       void set_pixel(const Point &p) override;
       void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
       void get_dither_candidates(const RGB &col, const RGB *palette, size_t len, std::array<uint8_t, 16> &candidates);
+      void build_candidate_cache(); // if the palette has changed since it was last built
       void set_pixel_dither(const Point &p, const RGB &c) override;
 
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
       void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
       static size_t buffer_size(uint w, uint h) {
         return w * h;
       }
@@ -343,16 +535,22 @@ namespace pimoroni {
       PicoGraphics_PenRGB332(uint16_t width, uint16_t height, void *frame_buffer);
       void set_pen(uint c) override;
       void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
       int create_pen(uint8_t r, uint8_t g, uint8_t b) override;
 
       void set_pixel(const Point &p) override;
       void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
       void set_pixel_dither(const Point &p, const RGB &c) override;
       void set_pixel_dither(const Point &p, const RGB565 &c) override;
+      void set_pixel_alpha(const Point &p, const uint8_t alpha) override;
 
       void sprite(void* data, const Point &sprite, const Point &dest, const int scale, const int transparent) override;
 
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
       void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
       static size_t buffer_size(uint w, uint h) {
         return w * h;
       }
@@ -365,25 +563,151 @@ namespace pimoroni {
       PicoGraphics_PenRGB565(uint16_t width, uint16_t height, void *frame_buffer);
       void set_pen(uint c) override;
       void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
       int create_pen(uint8_t r, uint8_t g, uint8_t b) override;
       void set_pixel(const Point &p) override;
       void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
+      void set_pixel_dither(const Point &p, const RGB &c) override;
+      void set_pixel_alpha(const Point &p, const uint8_t alpha) override;
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
+      void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
       static size_t buffer_size(uint w, uint h) {
         return w * h * sizeof(RGB565);
       }
   };
 
+  // RGB565 framebuffer split into 16x16 tiles, each either a single solid
+  // colour or a full tile of pixels allocated from a fixed pool. Flat UIs
+  // need only a fraction of the RAM of PicoGraphics_PenRGB565 and clears or
+  // large rectangle fills collapse to a tile colour write.
+  class PicoGraphics_PenRGB565Tiled : public PicoGraphics {
+    public:
+      static constexpr uint TILE_SIZE = 16;
+      static constexpr uint TILE_PIXELS = TILE_SIZE * TILE_SIZE;
+      static constexpr uint16_t TILE_SOLID = 0xffff;
+
+      RGB src_color;
+      RGB565 color;
+
+      uint16_t tiles_x;
+      uint16_t tiles_y;
+      uint16_t pool_tiles;
+      uint16_t free_count;
+      bool pool_exhausted = false; // set if a write was dropped because the pool ran out
+
+      RGB565 *pool;          // pool_tiles * TILE_PIXELS pixels
+      RGB565 *tile_color;    // colour of each solid tile
+      uint16_t *tile_slot;   // pool slot backing each tile, or TILE_SOLID
+      uint16_t *free_slots;  // stack of unused pool slots
+
+      PicoGraphics_PenRGB565Tiled(uint16_t width, uint16_t height, void *frame_buffer, uint16_t pool_tiles = 0);
+      void set_pen(uint c) override;
+      void set_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      uint get_pen() override;
+      int create_pen(uint8_t r, uint8_t g, uint8_t b) override;
+      void set_pixel(const Point &p) override;
+      void set_pixel_span(const Point &p, uint l) override;
+      uint get_pixel(const Point &p) override;
+      void set_pixel_rect(const Rect &r) override;
+      void set_pixel_dither(const Point &p, const RGB &c) override;
+      void set_pixel_alpha(const Point &p, const uint8_t alpha) override;
+      void set_framebuffer(void *frame_buffer) override;
+
+      void copy_pixel_rect(const Rect &src, const Point &dest) override;
+      void set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) override;
+      void scanline_convert(PenType type, conversion_callback_func callback) override;
+      void scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) override;
+
+      uint16_t tiles_used() {
+        return pool_tiles - free_count;
+      }
+
+      static uint16_t default_pool_tiles(uint w, uint h) {
+        // a quarter of the screen's worth of tiles
+        uint tiles = ((w + TILE_SIZE - 1) / TILE_SIZE) * ((h + TILE_SIZE - 1) / TILE_SIZE);
+        return (tiles + 3) / 4;
+      }
+      static size_t buffer_size(uint w, uint h, uint pool_tiles = 0) {
+        uint tiles = ((w + TILE_SIZE - 1) / TILE_SIZE) * ((h + TILE_SIZE - 1) / TILE_SIZE);
+        if(pool_tiles == 0) pool_tiles = default_pool_tiles(w, h);
+        return pool_tiles * TILE_PIXELS * sizeof(RGB565)
+             + tiles * (sizeof(RGB565) + sizeof(uint16_t))
+             + pool_tiles * sizeof(uint16_t);
+      }
+
+    private:
+      void reset_tiles();
+      RGB565 *expand_tile(uint t);
+      void release_tile(uint t);
+  };
+
+  // caches runs of text rendered in a particular font, scale and angle as
+  // 1-bit masks in a fixed size pool, so that labels drawn every frame cost
+  // a mask blit (in any pen colour) instead of going through the fonts. the
+  // least recently used masks are dropped to make room for new ones
+  class TextCache {
+    public:
+      static const uint MAX_ENTRIES = 16;
+
+      struct Entry {
+        bool used = false;
+        uint32_t last_used;
+        std::string text;
+        const void *font;     // bitmap or hershey font it was rendered with
+        int32_t wrap;
+        float scale;
+        float angle;
+        uint8_t letter_spacing;
+        Point offset;         // top left of the mask relative to the text origin
+        uint16_t w, h;        // size of the mask, w is a multiple of 8
+        uint32_t start;       // offset of the mask in the pool
+      };
+
+      uint32_t hits = 0;
+      uint32_t misses = 0;
+
+      TextCache(size_t pool_size, void *pool = nullptr);
+      void text(PicoGraphics &g, const std::string &t, const Point &p, int32_t wrap, float s = 2.0f, float a = 0.0f, uint8_t letter_spacing = 1);
+      void clear();
+
+    private:
+      uint8_t *pool;
+      size_t pool_size;
+      uint32_t clock = 0;
+      Entry entries[MAX_ENTRIES];
+
+      Entry *find(PicoGraphics &g, const std::string &t, int32_t wrap, float s, float a, uint8_t letter_spacing);
+      Entry *allocate(size_t size);
+      Entry *render(PicoGraphics &g, const std::string &t, int32_t wrap, float s, float a, uint8_t letter_spacing);
+      void blit(PicoGraphics &g, const Entry &e, const Point &p);
+  };
+
   class DisplayDriver {
     public:
       uint16_t width;
       uint16_t height;
       Rotation rotation;
 
+      // called when an update_async (or partial_update_async) has finished,
+      // from an interrupt on drivers that finish their updates in one
+      std::function<void()> update_callback;
+
       DisplayDriver(uint16_t width, uint16_t height, Rotation rotation)
        : width(width), height(height), rotation(rotation) {};
 
       virtual void update(PicoGraphics *display) {};
+      // starts an update and returns while it is still in progress (see is_busy),
+      // drivers that can't do this just update
+      virtual void update_async(PicoGraphics *display) {update(display);};
       virtual void partial_update(PicoGraphics *display, Rect region) {};
+      virtual void partial_update_async(PicoGraphics *display, Rect region) {partial_update(display, region);};
+      // regions queued up are sent together by update_queued, drivers that
+      // can't merge them just update everything
+      virtual void queue_update(Rect region) {};
+      virtual void update_queued(PicoGraphics *display) {update_async(display);};
       virtual void set_backlight(uint8_t brightness) {};
       virtual bool is_busy() {return false;};
       virtual void cleanup() {};
@@ -0,0 +1,364 @@
+#include <cmath>
+
+#include "pico_graphics.hpp"
+
+namespace pimoroni {
+
+  // number of points that follow each command
+  static const uint8_t path_command_points[] = {1, 1, 2, 3, 0};
+
+  // curves are split until they are within a quarter of a pixel (in 1/16ths)
+  static const int32_t PATH_TOLERANCE = 4;
+  static const int32_t PATH_MAX_STEPS = 64;
+
+  Path::Path(uint16_t width, uint16_t height, uint8_t flags) {
+    buffer = {MAGIC, flags,
+      uint8_t(width & 0xff), uint8_t(width >> 8),
+      uint8_t(height & 0xff), uint8_t(height >> 8)};
+  }
+
+  Path::Path(const uint8_t *data, size_t size) : external(data), external_size(size) {
+  }
+
+  void Path::add(Command c, std::initializer_list<Point> points) {
+    buffer.push_back(c);
+    for(auto &p : points) {
+      // coordinates are stored as int16 with four fractional bits
+      if(p.x < COORD_MIN || p.x > COORD_MAX || p.y < COORD_MIN || p.y > COORD_MAX) overflow = true;
+      int16_t x = p.x * 16;
+      int16_t y = p.y * 16;
+      buffer.push_back(x & 0xff); buffer.push_back(uint16_t(x) >> 8);
+      buffer.push_back(y & 0xff); buffer.push_back(uint16_t(y) >> 8);
+    }
+  }
+
+  void Path::move_to(const Point &p) {
+    add(MOVE, {p});
+  }
+
+  void Path::line_to(const Point &p) {
+    add(LINE, {p});
+  }
+
+  void Path::quad_to(const Point &c, const Point &p) {
+    add(QUAD, {c, p});
+  }
+
+  void Path::cubic_to(const Point &c1, const Point &c2, const Point &p) {
+    add(CUBIC, {c1, c2, p});
+  }
+
+  void Path::close() {
+    add(CLOSE, {});
+  }
+
+  const uint8_t *Path::data() const {
+    return external ? external : buffer.data();
+  }
+
+  size_t Path::size() const {
+    return external ? external_size : buffer.size();
+  }
+
+  bool Path::valid() const {
+    return !overflow && size() >= HEADER_SIZE && data()[0] == MAGIC;
+  }
+
+  uint16_t Path::width() const {
+    return valid() ? data()[2] | (data()[3] << 8) : 0;
+  }
+
+  uint16_t Path::height() const {
+    return valid() ? data()[4] | (data()[5] << 8) : 0;
+  }
+
+  uint8_t Path::flags() const {
+    return valid() ? data()[1] : 0;
+  }
+
+  // a path flattened into straight edged contours, all coordinates are in
+  // screen space with four fractional bits
+  struct FlatPath {
+    std::vector<Point> points;
+    std::vector<uint16_t> ends; // index one past the last point of each contour
+    std::vector<bool> closed;
+  };
+
+  static void flatten_quad(std::vector<Point> &out, Point p0, Point p1, Point p2) {
+    // the chord is out by at most a quarter of the second difference, which
+    // shrinks with the square of the number of steps
+    int32_t ddx = p0.x - 2 * p1.x + p2.x;
+    int32_t ddy = p0.y - 2 * p1.y + p2.y;
+    int32_t dd = std::max(std::abs(ddx), std::abs(ddy));
+    int32_t n = std::clamp(int32_t(ceilf(sqrtf(float(dd) / float(4 * PATH_TOLERANCE)))), 1, PATH_MAX_STEPS);
+
+    int32_t nn = n * n;
+    for(int32_t i = 1; i <= n; i++) {
+      int32_t a = (n - i) * (n - i), b = 2 * i * (n - i), c = i * i;
+      out.push_back(Point(
+        (a * p0.x + b * p1.x + c * p2.x) / nn,
+        (a * p0.y + b * p1.y + c * p2.y) / nn
+      ));
+    }
+  }
+
+  static void flatten_cubic(std::vector<Point> &out, Point p0, Point p1, Point p2, Point p3) {
+    int32_t dd = std::max({
+      std::abs(p0.x - 2 * p1.x + p2.x), std::abs(p0.y - 2 * p1.y + p2.y),
+      std::abs(p1.x - 2 * p2.x + p3.x), std::abs(p1.y - 2 * p2.y + p3.y)
+    });
+    int32_t n = std::clamp(int32_t(ceilf(sqrtf(float(3 * dd) / float(4 * PATH_TOLERANCE)))), 1, PATH_MAX_STEPS);
+
+    int64_t nnn = n * n * n;
+    for(int32_t i = 1; i <= n; i++) {
+      int64_t u = n - i, t = i;
+      int64_t a = u * u * u, b = 3 * u * u * t, c = 3 * u * t * t, d = t * t * t;
+      out.push_back(Point(
+        int32_t((a * p0.x + b * p1.x + c * p2.x + d * p3.x) / nnn),
+        int32_t((a * p0.y + b * p1.y + c * p2.y + d * p3.y) / nnn)
+      ));
+    }
+  }
+
+  // decodes a path, placing it at origin and scaling it, and flattens curves
+  // into line segments. stops early on truncated or malformed data
+  static void flatten_path(const Path &path, const Point &origin, float scale, FlatPath &flat) {
+    if(!path.valid()) return;
+
+    const uint8_t *data = path.data();
+    size_t size = path.size();
+    size_t i = Path::HEADER_SIZE;
+
+    int32_t s = int32_t(scale * 65536.0f);
+    auto transform = [&](const Point &p) {
+      return Point(
+        origin.x * 16 + int32_t((int64_t(p.x) * s) >> 16),
+        origin.y * 16 + int32_t((int64_t(p.y) * s) >> 16)
+      );
+    };
+
+    Point last;          // last decoded point, in path space
+    Point current;       // current pen position, in screen space
+    Point start;         // start of the current contour
+    bool open = false;
+
+    auto end_contour = [&](bool closed) {
+      if(open) {
+        flat.ends.push_back(flat.points.size());
+        flat.closed.push_back(closed);
+        open = false;
+      }
+    };
+
+    while(i < size) {
+      uint8_t op = data[i++];
+      bool relative = op & Path::RELATIVE;
+      op &= ~Path::RELATIVE;
+      if(op > Path::CLOSE) return;
+
+      uint8_t count = path_command_points[op];
+      if(i + count * (relative ? 2 : 4) > size) return;
+
+      Point p[3];
+      for(auto j = 0u; j < count; j++) {
+        if(relative) {
+          last.x += int8_t(data[i]);
+          last.y += int8_t(data[i + 1]);
+          i += 2;
+        } else {
+          last.x = int16_t(data[i] | (data[i + 1] << 8));
+          last.y = int16_t(data[i + 2] | (data[i + 3] << 8));
+          i += 4;
+        }
+        p[j] = transform(last);
+      }
+
+      if(op == Path::MOVE) {
+        end_contour(false);
+        current = start = p[0];
+        continue;
+      }
+
+      if(op == Path::CLOSE) {
+        end_contour(true);
+        current = start;
+        continue;
+      }
+
+      if(!open) {
+        flat.points.push_back(current);
+        start = current;
+        open = true;
+      }
+
+      switch(op) {
+        case Path::LINE:
+          flat.points.push_back(p[0]);
+          break;
+        case Path::QUAD:
+          flatten_quad(flat.points, current, p[0], p[1]);
+          break;
+        case Path::CUBIC:
+          flatten_cubic(flat.points, current, p[0], p[1], p[2]);
+          break;
+      }
+      current = p[count - 1];
+    }
+
+    end_contour(false);
+  }
+
+  // pixels covered by a set of points with four fractional bits, inflated
+  // by a margin in whole pixels
+  static Rect path_bounds(const Point *points, size_t count, int32_t margin = 0) {
+    if(count == 0) return Rect();
+    int32_t minx = points[0].x, maxx = points[0].x;
+    int32_t miny = points[0].y, maxy = points[0].y;
+    for(size_t i = 1; i < count; i++) {
+      minx = std::min(minx, points[i].x);
+      maxx = std::max(maxx, points[i].x);
+      miny = std::min(miny, points[i].y);
+      maxy = std::max(maxy, points[i].y);
+    }
+    Rect bounds(minx >> 4, miny >> 4, (maxx >> 4) - (minx >> 4) + 1, (maxy >> 4) - (miny >> 4) + 1);
+    bounds.inflate(margin);
+    return bounds;
+  }
+
+  // scanline fills a set of contours with four fractional bits of precision,
+  // sampling each pixel at its centre
+  static void fill_contours(PicoGraphics *g, const Point *points, const uint16_t *ends, size_t contours, bool even_odd) {
+    struct Node {
+      int32_t x;
+      int32_t dir;
+    };
+    std::vector<Node> nodes; // edge crossings on the current scanline
+    nodes.reserve(16);
+
+    size_t total = contours ? ends[contours - 1] : 0;
+    if(total < 3) return;
+
+    int32_t miny = points[0].y, maxy = points[0].y;
+    for(size_t i = 1; i < total; i++) {
+      miny = std::min(miny, points[i].y);
+      maxy = std::max(maxy, points[i].y);
+    }
+
+    const Rect &clip = g->clip;
+    int32_t y1 = std::max(clip.y, (miny - 8 + 15) >> 4);
+    int32_t y2 = std::min(clip.y + clip.h - 1, (maxy - 8) >> 4);
+
+    for(int32_t y = y1; y <= y2; y++) {
+      int32_t fy = y * 16 + 8;
+      nodes.clear();
+
+      size_t first = 0;
+      for(size_t c = 0; c < contours; c++) {
+        size_t last = ends[c];
+        for(size_t i = first; i < last; i++) {
+          const Point &a = points[i];
+          const Point &b = points[i + 1 < last ? i + 1 : first];
+          int32_t dir = 0;
+          if(a.y <= fy && b.y > fy) dir = 1;
+          if(b.y <= fy && a.y > fy) dir = -1;
+          if(dir == 0) continue;
+
+          int32_t x = a.x + int32_t(int64_t(fy - a.y) * (b.x - a.x) / (b.y - a.y));
+          nodes.push_back({x, dir});
+        }
+        first = last;
+      }
+
+      // insertion sort, there are only ever a handful of crossings
+      size_t n = nodes.size();
+      for(size_t i = 1; i < n; i++) {
+        Node k = nodes[i];
+        int32_t j = int32_t(i) - 1;
+        while(j >= 0 && nodes[j].x > k.x) {
+          nodes[j + 1] = nodes[j];
+          j--;
+        }
+        nodes[j + 1] = k;
+      }
+
+      int32_t winding = 0, span_start = 0;
+      for(size_t i = 0; i < n; i++) {
+        bool was_inside = even_odd ? (winding & 1) : winding != 0;
+        winding += nodes[i].dir;
+        bool inside = even_odd ? (winding & 1) : winding != 0;
+
+        if(!was_inside && inside) {
+          span_start = nodes[i].x;
+        } else if(was_inside && !inside) {
+          // pixels whose centres fall inside the span
+          int32_t x1 = (span_start - 8 + 15) >> 4;
+          int32_t x2 = (nodes[i].x - 8 + 15) >> 4;
+          if(x2 > x1) g->pixel_span(Point(x1, y), x2 - x1);
+        }
+      }
+    }
+  }
+
+  void PicoGraphics::fill_path(const Path &path, const Point &origin, float scale) {
+    FlatPath flat;
+    flatten_path(path, origin, scale, flat);
+
+    // path in screen bounds?
+    if(path_bounds(flat.points.data(), flat.points.size()).intersection(clip).empty()) return;
+
+    fill_contours(this, flat.points.data(), flat.ends.data(), flat.ends.size(), path.flags() & Path::EVEN_ODD);
+  }
+
+  void PicoGraphics::stroke_path(const Path &path, int32_t width, const Point &origin, float scale) {
+    FlatPath flat;
+    flatten_path(path, origin, scale, flat);
+
+    // path, including the caps and joins, in screen bounds?
+    if(path_bounds(flat.points.data(), flat.points.size(), width / 2 + 1).intersection(clip).empty()) return;
+
+    auto to_pixel = [](const Point &p) {
+      return Point((p.x + 8) >> 4, (p.y + 8) >> 4);
+    };
+
+    size_t first = 0;
+    for(size_t c = 0; c < flat.ends.size(); c++) {
+      size_t last = flat.ends[c];
+      size_t segments = last - first - (flat.closed[c] ? 0 : 1);
+
+      for(size_t i = 0; i < segments; i++) {
+        const Point &a = flat.points[first + i];
+        const Point &b = flat.points[first + i + 1 < last ? first + i + 1 : first];
+
+        if(width <= 1) {
+          line(to_pixel(a), to_pixel(b));
+          continue;
+        }
+
+        // each segment is filled as a quad offset either side of the line
+        // with round joins and caps from a circle at every vertex
+        float dx = b.x - a.x, dy = b.y - a.y;
+        float len = sqrtf(dx * dx + dy * dy);
+        if(len > 0.0f) {
+          int32_t nx = int32_t(-dy * width * 8.0f / len);
+          int32_t ny = int32_t( dx * width * 8.0f / len);
+          Point quad[4] = {
+            Point(a.x + nx, a.y + ny), Point(b.x + nx, b.y + ny),
+            Point(b.x - nx, b.y - ny), Point(a.x - nx, a.y - ny)
+          };
+          uint16_t end = 4;
+          fill_contours(this, quad, &end, 1, false);
+        }
+
+        circle(to_pixel(a), width / 2);
+      }
+
+      // cap the end of an open contour
+      if(!flat.closed[c] && last > first) {
+        circle(to_pixel(flat.points[last - 1]), width <= 1 ? 0 : width / 2);
+      }
+
+      first = last;
+    }
+  }
+
+}
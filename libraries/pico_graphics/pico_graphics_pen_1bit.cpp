@@ -18,6 +18,10 @@ namespace pimoroni {
     color = r != 0 || g != 0 || b != 0 ? 1 : 0;
   }
 
+  uint PicoGraphics_Pen1Bit::get_pen() {
+    return color;
+  }
+
   void PicoGraphics_Pen1Bit::set_pixel(const Point &p) {
     // pointer to byte in framebuffer that contains this pixel
     uint8_t *buf = (uint8_t *)frame_buffer;
@@ -57,4 +61,74 @@ namespace pimoroni {
     }
   }
 
+  uint PicoGraphics_Pen1Bit::get_pixel(const Point &p) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    uint8_t *f = &buf[(p.x / 8) + (p.y * bounds.w / 8)];
+
+    uint bo = 7 - (p.x & 0b111);
+
+    return (*f >> bo) & 0b1;
+  }
+
+  void PicoGraphics_Pen1Bit::set_pixel_dither(const Point &p, const RGB &c) {
+    if(!bounds.contains(p)) return;
+    color = dither_1bit(p, c);
+    set_pixel(p);
+  }
+  void PicoGraphics_Pen1Bit::copy_pixel_rect(const Rect &src, const Point &dest) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    // rows go through a temporary buffer since the source and destination
+    // may not be byte aligned with each other
+    uint8_t row_buf[(src.w + 7) / 8];
+    for(auto i = 0; i < src.h; i++) {
+      int32_t row = dest.y > src.y ? src.h - 1 - i : i;
+      copy_bits(&buf[(src.y + row) * bounds.w / 8], src.x, src.w, row_buf);
+      paste_bits(row_buf, &buf[(dest.y + row) * bounds.w / 8], dest.x, src.w);
+    }
+  }
+  void PicoGraphics_Pen1Bit::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+
+    if(src_format == PEN_1BIT) {
+      // line the source up with the start of a byte, then shift it into place
+      uint8_t row_buf[(l + 7) / 8];
+      copy_bits(src, offset, l, row_buf);
+      paste_bits(row_buf, &buf[p.y * bounds.w / 8], p.x, l);
+    } else if(src_format == PEN_RGB888) {
+      // dither to a row of black and white, then shift it into place
+      uint8_t row_buf[(l + 7) / 8];
+      dither_row_1bit(p, l, src + offset * 3, row_buf);
+      paste_bits(row_buf, &buf[p.y * bounds.w / 8], p.x, l);
+    }
+  }
+
+  void PicoGraphics_Pen1Bit::scanline_convert(PenType type, conversion_callback_func callback) {
+    scanline_convert(type, bounds, callback);
+  }
+
+  void PicoGraphics_Pen1Bit::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+    Rect r = region.intersection(bounds);
+    if(r.empty()) return;
+
+    uint8_t *buf = (uint8_t *)frame_buffer;
+
+    if(type == PEN_RGB565) {
+      uint16_t row_buf[r.w];
+      for(auto y = r.y; y < r.y + r.h; y++) {
+        uint8_t *src = &buf[y * bounds.w / 8];
+        for(auto x = 0; x < r.w; x++) {
+          uint px = r.x + x;
+          row_buf[x] = (src[px / 8] >> (7 - (px & 0b111))) & 0b1 ? 0xffff : 0x0000;
+        }
+        callback(row_buf, r.w * sizeof(RGB565));
+      }
+    } else if(type == PEN_1BIT) {
+      // each row is shifted to start on a byte boundary
+      uint8_t row_buf[(r.w + 7) / 8];
+      for(auto y = r.y; y < r.y + r.h; y++) {
+        copy_bits(&buf[y * bounds.w / 8], r.x, r.w, row_buf);
+        callback(row_buf, sizeof(row_buf));
+      }
+    }
+  }
 }
\ No newline at end of file
@@ -18,6 +18,10 @@ namespace pimoroni {
     color = r != 0 || g != 0 || b != 0 ? 1 : 0;
   }
 
+  uint PicoGraphics_Pen1BitY::get_pen() {
+    return color;
+  }
+
   void PicoGraphics_Pen1BitY::set_pixel(const Point &p) {
     // pointer to byte in framebuffer that contains this pixel
     uint8_t *buf = (uint8_t *)frame_buffer;
@@ -40,4 +44,80 @@ namespace pimoroni {
     }
   }
 
+  uint PicoGraphics_Pen1BitY::get_pixel(const Point &p) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    uint8_t *f = &buf[(p.y / 8) + (p.x * bounds.h / 8)];
+
+    uint bo = 7 - (p.y & 0b111);
+
+    return (*f >> bo) & 0b1;
+  }
+
+  void PicoGraphics_Pen1BitY::set_pixel_dither(const Point &p, const RGB &c) {
+    if(!bounds.contains(p)) return;
+    color = dither_1bit(p, c);
+    set_pixel(p);
+  }
+  void PicoGraphics_Pen1BitY::copy_pixel_rect(const Rect &src, const Point &dest) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    // the framebuffer is stored in columns, so copy a column at a time
+    uint8_t col_buf[(src.h + 7) / 8];
+    for(auto i = 0; i < src.w; i++) {
+      int32_t col = dest.x > src.x ? src.w - 1 - i : i;
+      copy_bits(&buf[(src.x + col) * bounds.h / 8], src.y, src.h, col_buf);
+      paste_bits(col_buf, &buf[(dest.x + col) * bounds.h / 8], dest.y, src.h);
+    }
+  }
+  void PicoGraphics_Pen1BitY::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+    // RGB888 is dithered to a row of black and white first
+    uint8_t row_buf[src_format == PEN_RGB888 ? (l + 7) / 8 : 1];
+    if(src_format == PEN_RGB888) {
+      dither_row_1bit(p, l, src + offset * 3, row_buf);
+      src = row_buf;
+      offset = 0;
+    } else if(src_format != PEN_1BIT) {
+      return;
+    }
+
+    // the source is in rows, which run across the columns of the framebuffer
+    // so there's no shortcut, set the bit for the row in each column
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    uint bo = 7 - (p.y & 0b111);
+    for(auto i = 0u; i < l; i++) {
+      uint bit = offset + i;
+      uint8_t *f = &buf[(p.y / 8) + ((p.x + i) * bounds.h / 8)];
+      *f = (*f & ~(1U << bo)) | (((src[bit / 8] >> (7 - (bit & 0b111))) & 0b1) << bo);
+    }
+  }
+
+  void PicoGraphics_Pen1BitY::scanline_convert(PenType type, conversion_callback_func callback) {
+    scanline_convert(type, bounds, callback);
+  }
+
+  void PicoGraphics_Pen1BitY::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+    Rect r = region.intersection(bounds);
+    if(r.empty()) return;
+
+    uint8_t *buf = (uint8_t *)frame_buffer;
+
+    if(type == PEN_RGB565) {
+      uint16_t row_buf[r.w];
+      for(auto y = r.y; y < r.y + r.h; y++) {
+        uint8_t *src = &buf[y / 8];
+        uint bo = 7 - (y & 0b111);
+        for(auto x = 0; x < r.w; x++) {
+          row_buf[x] = (src[(r.x + x) * bounds.h / 8] >> bo) & 0b1 ? 0xffff : 0x0000;
+        }
+        callback(row_buf, r.w * sizeof(RGB565));
+      }
+    } else if(type == PEN_1BIT) {
+      // the framebuffer is stored in columns, so columns are sent in the
+      // native format, each shifted to start on a byte boundary
+      uint8_t col_buf[(r.h + 7) / 8];
+      for(auto x = r.x; x < r.x + r.w; x++) {
+        copy_bits(&buf[x * bounds.h / 8], r.y, r.h, col_buf);
+        callback(col_buf, sizeof(col_buf));
+      }
+    }
+  }
 }
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "pico_graphics.hpp"
+
+namespace pimoroni {
+
+  PicoGraphics_Pen1BitPaged::PicoGraphics_Pen1BitPaged(uint16_t width, uint16_t height, void *frame_buffer)
+    : PicoGraphics(width, height, frame_buffer) {
+    this->pen_type = PEN_1BIT_PAGED;
+    this->pages = (height + 7) / 8;
+    if(this->frame_buffer == nullptr) {
+      this->frame_buffer = (void *)(new uint8_t[buffer_size(width, height)]);
+    }
+    set_framebuffer(this->frame_buffer);
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_framebuffer(void *frame_buffer) {
+    this->frame_buffer = frame_buffer;
+    if(frame_buffer == nullptr) return;
+
+    // the dirty ranges follow the pages, and the whole of a new buffer
+    // needs sending. They're set outright since a buffer that wasn't
+    // zeroed holds whatever was left in that memory
+    dirty_start = (uint16_t *)((uint8_t *)frame_buffer + page_bytes(bounds.w, bounds.h));
+    dirty_end = dirty_start + pages;
+    for(auto page = 0u; page < pages; page++) {
+      dirty_start[page] = 0;
+      dirty_end[page] = bounds.w;
+    }
+  }
+
+  void PicoGraphics_Pen1BitPaged::mark_dirty(const Rect &r) {
+    Rect d = r.intersection(bounds);
+    if(d.empty()) return;
+    for(auto page = d.y / 8; page <= (d.y + d.h - 1) / 8; page++) {
+      if(dirty_start[page] == dirty_end[page]) {
+        dirty_start[page] = d.x;
+        dirty_end[page] = d.x + d.w;
+      } else {
+        dirty_start[page] = std::min(dirty_start[page], uint16_t(d.x));
+        dirty_end[page] = std::max(dirty_end[page], uint16_t(d.x + d.w));
+      }
+    }
+  }
+
+  void PicoGraphics_Pen1BitPaged::clear_dirty() {
+    for(auto page = 0u; page < pages; page++) {
+      dirty_start[page] = dirty_end[page] = 0;
+    }
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pen(uint c) {
+    color = c != 0 ? 1 : 0;
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pen(uint8_t r, uint8_t g, uint8_t b) {
+    color = r != 0 || g != 0 || b != 0 ? 1 : 0;
+  }
+
+  uint PicoGraphics_Pen1BitPaged::get_pen() {
+    return color;
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pixel(const Point &p) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    uint8_t *f = &buf[(p.y / 8) * bounds.w + p.x];
+
+    uint bo = p.y & 0b111;
+
+    *f = (*f & ~(1U << bo)) | (color << bo);
+
+    mark_dirty(Rect(p.x, p.y, 1, 1));
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pixel_span(const Point &p, uint l) {
+    // a span runs along the page, one byte per pixel
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    uint8_t *f = &buf[(p.y / 8) * bounds.w + p.x];
+
+    uint8_t mask = 1U << (p.y & 0b111);
+    uint8_t bits = color ? mask : 0;
+
+    for(auto i = 0u; i < l; i++) {
+      f[i] = (f[i] & ~mask) | bits;
+    }
+
+    mark_dirty(Rect(p.x, p.y, l, 1));
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pixel_rect(const Rect &r) {
+    // fill up to eight rows of each column in one go
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    int32_t y = r.y;
+    while(y < r.y + r.h) {
+      int32_t page_end = (y / 8 + 1) * 8;
+      int32_t rows = std::min(page_end, r.y + r.h) - y;
+
+      uint8_t mask = ((1U << rows) - 1) << (y & 0b111);
+      uint8_t bits = color ? mask : 0;
+
+      uint8_t *f = &buf[(y / 8) * bounds.w + r.x];
+      for(auto i = 0; i < r.w; i++) {
+        f[i] = (f[i] & ~mask) | bits;
+      }
+
+      y += rows;
+    }
+
+    mark_dirty(r);
+  }
+
+  uint PicoGraphics_Pen1BitPaged::get_pixel(const Point &p) {
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    return (buf[(p.y / 8) * bounds.w + p.x] >> (p.y & 0b111)) & 0b1;
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pixel_dither(const Point &p, const RGB &c) {
+    if(!bounds.contains(p)) return;
+    color = dither_1bit(p, c);
+    set_pixel(p);
+  }
+
+  void PicoGraphics_Pen1BitPaged::copy_pixel_rect(const Rect &src, const Point &dest) {
+    // pixels are copied one at a time, in whichever order avoids
+    // overwriting ones not yet copied
+    uint8_t saved = color;
+    for(auto j = 0; j < src.h; j++) {
+      int32_t row = dest.y > src.y ? src.h - 1 - j : j;
+      for(auto i = 0; i < src.w; i++) {
+        int32_t col = dest.x > src.x ? src.w - 1 - i : i;
+        color = get_pixel(Point(src.x + col, src.y + row));
+        set_pixel(Point(dest.x + col, dest.y + row));
+      }
+    }
+    color = saved;
+  }
+
+  void PicoGraphics_Pen1BitPaged::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+    // RGB888 is dithered to a row of black and white first
+    uint8_t row_buf[src_format == PEN_RGB888 ? (l + 7) / 8 : 1];
+    if(src_format == PEN_RGB888) {
+      dither_row_1bit(p, l, src + offset * 3, row_buf);
+      src = row_buf;
+      offset = 0;
+    } else if(src_format != PEN_1BIT && src_format != PEN_1BIT_PAGED) {
+      return;
+    }
+
+    // the source is in rows, as for PicoGraphics_Pen1Bit, which run along
+    // a page setting one bit of each byte
+    uint8_t *buf = (uint8_t *)frame_buffer;
+    uint8_t *f = &buf[(p.y / 8) * bounds.w + p.x];
+    uint bo = p.y & 0b111;
+    for(auto i = 0u; i < l; i++) {
+      uint bit = offset + i;
+      f[i] = (f[i] & ~(1U << bo)) | (((src[bit / 8] >> (7 - (bit & 0b111))) & 0b1) << bo);
+    }
+
+    mark_dirty(Rect(p.x, p.y, l, 1));
+  }
+
+  void PicoGraphics_Pen1BitPaged::scanline_convert(PenType type, conversion_callback_func callback) {
+    scanline_convert(type, bounds, callback);
+  }
+
+  void PicoGraphics_Pen1BitPaged::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+    Rect r = region.intersection(bounds);
+    if(r.empty()) return;
+
+    uint8_t *buf = (uint8_t *)frame_buffer;
+
+    if(type == PEN_RGB565) {
+      uint16_t row_buf[r.w];
+      for(auto y = r.y; y < r.y + r.h; y++) {
+        uint8_t *src = &buf[(y / 8) * bounds.w + r.x];
+        uint bo = y & 0b111;
+        for(auto x = 0; x < r.w; x++) {
+          row_buf[x] = (src[x] >> bo) & 0b1 ? 0xffff : 0x0000;
+        }
+        callback(row_buf, r.w * sizeof(RGB565));
+      }
+    } else if(type == PEN_1BIT_PAGED) {
+      // whole pages are passed straight from the framebuffer, the region's
+      // columns of every page it touches
+      for(auto page = r.y / 8; page <= (r.y + r.h - 1) / 8; page++) {
+        callback(&buf[page * bounds.w + r.x], r.w);
+      }
+    }
+  }
+}
@@ -25,6 +25,9 @@ namespace pimoroni {
         int pen = RGB(r, g, b).closest(palette, palette_size);
         if(pen != -1) color = pen;
     }
+    uint PicoGraphics_PenP4::get_pen() {
+        return color;
+    }
     int PicoGraphics_PenP4::update_pen(uint8_t i, uint8_t r, uint8_t g, uint8_t b) {
         i &= 0xf;
         used[i] = true;
@@ -81,6 +84,15 @@ namespace pimoroni {
         if(l) {*f &= 0b00001111; *f |= (cc & 0b11110000);}
     }
 
+    uint PicoGraphics_PenP4::get_pixel(const Point &p) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        uint8_t *f = &buf[(p.x / 2) + (p.y * bounds.w / 2)];
+
+        uint8_t  o = (~p.x & 0b1) * 4; // bit offset within byte
+
+        return (*f >> o) & 0b1111;
+    }
+
     void PicoGraphics_PenP4::get_dither_candidates(const RGB &col, const RGB *palette, size_t len, std::array<uint8_t, 16> &candidates) {
         RGB error;
         for(size_t i = 0; i < candidates.size(); i++) {
@@ -96,8 +108,8 @@ namespace pimoroni {
         });
     }
 
-    void PicoGraphics_PenP4::set_pixel_dither(const Point &p, const RGB &c) {
-        if(!bounds.contains(p)) return;
+    void PicoGraphics_PenP4::build_candidate_cache() {
+        if(cache_built) return;
 
         uint used_palette_entries = 0;
         for(auto i = 0u; i < palette_size; i++) {
@@ -105,13 +117,16 @@ namespace pimoroni {
             used_palette_entries++;
         }
 
-        if(!cache_built) {
-            for(uint i = 0; i < 512; i++) {
-                RGB cache_col((i & 0x1C0) >> 1, (i & 0x38) << 2, (i & 0x7) << 5);
-                get_dither_candidates(cache_col, palette, used_palette_entries, candidate_cache[i]);
-            }
-            cache_built = true;
+        for(uint i = 0; i < 512; i++) {
+            RGB cache_col((i & 0x1C0) >> 1, (i & 0x38) << 2, (i & 0x7) << 5);
+            get_dither_candidates(cache_col, palette, used_palette_entries, candidate_cache[i]);
         }
+        cache_built = true;
+    }
+    void PicoGraphics_PenP4::set_pixel_dither(const Point &p, const RGB &c) {
+        if(!bounds.contains(p)) return;
+
+        build_candidate_cache();
 
         uint cache_key = ((c.r & 0xE0) << 1) | ((c.g & 0xE0) >> 2) | ((c.b & 0xE0) >> 5);
         //get_dither_candidates(c, palette, 256, candidates);
@@ -124,7 +139,52 @@ namespace pimoroni {
         color = candidate_cache[cache_key][pattern[pattern_index]];
         set_pixel(p);
     }
+    void PicoGraphics_PenP4::copy_pixel_rect(const Rect &src, const Point &dest) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        // rows go through a temporary buffer since the source and destination
+        // may not be nibble aligned with each other
+        uint8_t row_buf[(src.w + 1) / 2];
+        for(auto i = 0; i < src.h; i++) {
+            int32_t row = dest.y > src.y ? src.h - 1 - i : i;
+            copy_bits(&buf[bounds.w * (src.y + row) / 2], src.x * 4, src.w * 4, row_buf);
+            paste_bits(row_buf, &buf[bounds.w * (dest.y + row) / 2], dest.x * 4, src.w * 4);
+        }
+    }
+    void PicoGraphics_PenP4::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+
+        if(src_format == PEN_P4) {
+            // line the source up with the start of a byte, then shift it into place
+            uint8_t row_buf[(l + 1) / 2];
+            copy_bits(src, offset * 4, l * 4, row_buf);
+            paste_bits(row_buf, &buf[bounds.w * p.y / 2], p.x * 4, l * 4);
+        } else if(src_format == PEN_RGB888) {
+            // dither to the palette, looking each pixel up in the candidate
+            // cache and writing it straight into the framebuffer
+            build_candidate_cache();
+            const uint *row_pattern = &pattern[(p.y & 0b11) << 2];
+            src += offset * 3;
+            for(auto i = 0u; i < l; i++) {
+                uint x = p.x + i;
+                uint cache_key = ((src[0] & 0xE0) << 1) | ((src[1] & 0xE0) >> 2) | ((src[2] & 0xE0) >> 5);
+                uint8_t c = candidate_cache[cache_key][row_pattern[x & 0b11]];
+                uint8_t *f = &buf[(x / 2) + (p.y * bounds.w / 2)];
+                uint8_t o = (~x & 0b1) * 4;
+                *f = (*f & ~(0b1111 << o)) | (c << o);
+                src += 3;
+            }
+        }
+    }
     void PicoGraphics_PenP4::scanline_convert(PenType type, conversion_callback_func callback) {
+        scanline_convert(type, bounds, callback);
+    }
+    void PicoGraphics_PenP4::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+        Rect r = region.intersection(bounds);
+        if(r.empty()) return;
+
+        // Treat our void* frame_buffer as uint8_t
+        uint8_t *src = (uint8_t *)frame_buffer;
+
         if(type == PEN_RGB565) {
             // Cache the RGB888 palette as RGB565
             RGB565 cache[palette_size];
@@ -132,29 +192,27 @@ namespace pimoroni {
                 cache[i] = palette[i].to_rgb565();
             }
 
-            // Treat our void* frame_buffer as uint8_t
-            uint8_t *src = (uint8_t *)frame_buffer;
-
             // Allocate a per-row temporary buffer
-            uint16_t row_buf[bounds.w];
-            for(auto y = 0; y < bounds.h; y++) {
-                /*if(scanline_interrupt != nullptr) {
-                    scanline_interrupt(y);
-                    // Cache the RGB888 palette as RGB565
-                    for(auto i = 0u; i < 16; i++) {
-                    cache[i] = palette[i].to_rgb565();
-                    }
-                }*/
-
-                for(auto x = 0; x < bounds.w; x++) {
-                    uint8_t c = src[(bounds.w * y / 2) + (x / 2)];
-                    uint8_t  o = (~x & 0b1) * 4; // bit offset within byte
-                    uint8_t  b = (c >> o) & 0xf; // bit value shifted to position
+            uint16_t row_buf[r.w];
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                uint8_t *row = &src[bounds.w * y / 2];
+                for(auto x = 0; x < r.w; x++) {
+                    uint px = r.x + x;
+                    uint8_t  c = row[px / 2];
+                    uint8_t  o = (~px & 0b1) * 4; // bit offset within byte
+                    uint8_t  b = (c >> o) & 0xf;  // bit value shifted to position
                     row_buf[x] = cache[b];
                 }
                 // Callback to the driver with the row data
-                callback(row_buf, bounds.w * sizeof(RGB565));
+                callback(row_buf, r.w * sizeof(RGB565));
+            }
+        } else if(type == PEN_P4) {
+            // Rows are shifted by a nibble when the region starts on an odd pixel
+            uint8_t row_buf[(r.w + 1) / 2];
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                copy_bits(&src[bounds.w * y / 2], r.x * 4, r.w * 4, row_buf);
+                callback(row_buf, sizeof(row_buf));
             }
         }
     }
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 #include "pico_graphics.hpp"
+#include <string.h>
 
 namespace pimoroni {
     PicoGraphics_PenP8::PicoGraphics_PenP8(uint16_t width, uint16_t height, void *frame_buffer)
@@ -20,6 +21,9 @@ namespace pimoroni {
         int pen = RGB(r, g, b).closest(palette, 16);
         if(pen != -1) color = pen;
     }
+    uint PicoGraphics_PenP8::get_pen() {
+        return color;
+    }
     int PicoGraphics_PenP8::update_pen(uint8_t i, uint8_t r, uint8_t g, uint8_t b) {
         i &= 0xff;
         used[i] = true;
@@ -60,6 +64,11 @@ namespace pimoroni {
         }
     }
 
+    uint PicoGraphics_PenP8::get_pixel(const Point &p) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        return buf[p.y * bounds.w + p.x];
+    }
+
     void PicoGraphics_PenP8::get_dither_candidates(const RGB &col, const RGB *palette, size_t len, std::array<uint8_t, 16> &candidates) {
         RGB error;
         for(size_t i = 0; i < candidates.size(); i++) {
@@ -75,16 +84,19 @@ namespace pimoroni {
         });
     }
 
+    void PicoGraphics_PenP8::build_candidate_cache() {
+        if(cache_built) return;
+
+        for(uint i = 0; i < 512; i++) {
+            RGB cache_col((i & 0x1C0) >> 1, (i & 0x38) << 2, (i & 0x7) << 5);
+            get_dither_candidates(cache_col, palette, palette_size, candidate_cache[i]);
+        }
+        cache_built = true;
+    }
     void PicoGraphics_PenP8::set_pixel_dither(const Point &p, const RGB &c) {
         if(!bounds.contains(p)) return;
 
-        if(!cache_built) {
-            for(uint i = 0; i < 512; i++) {
-                RGB cache_col((i & 0x1C0) >> 1, (i & 0x38) << 2, (i & 0x7) << 5);
-                get_dither_candidates(cache_col, palette, palette_size, candidate_cache[i]);
-            }
-            cache_built = true;
-        }
+        build_candidate_cache();
 
         uint cache_key = ((c.r & 0xE0) << 1) | ((c.g & 0xE0) >> 2) | ((c.b & 0xE0) >> 5);
         //get_dither_candidates(c, palette, 256, candidates);
@@ -97,8 +109,44 @@ namespace pimoroni {
         color = candidate_cache[cache_key][pattern[pattern_index]];
         set_pixel(p);
     }
+    void PicoGraphics_PenP8::copy_pixel_rect(const Rect &src, const Point &dest) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        // copy rows in whichever order avoids overwriting rows not yet copied
+        for(auto i = 0; i < src.h; i++) {
+            int32_t row = dest.y > src.y ? src.h - 1 - i : i;
+            memmove(&buf[(dest.y + row) * bounds.w + dest.x], &buf[(src.y + row) * bounds.w + src.x], src.w);
+        }
+    }
+    void PicoGraphics_PenP8::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+
+        if(src_format == PEN_P8) {
+            memcpy(&buf[p.y * bounds.w + p.x], &src[offset], l);
+        } else if(src_format == PEN_RGB888) {
+            // dither to the palette, looking each pixel up in the candidate
+            // cache and writing it straight into the framebuffer
+            build_candidate_cache();
+            const uint *row_pattern = &pattern[(p.y & 0b11) << 2];
+            uint8_t *dest = &buf[p.y * bounds.w + p.x];
+            src += offset * 3;
+            for(auto i = 0u; i < l; i++) {
+                uint cache_key = ((src[0] & 0xE0) << 1) | ((src[1] & 0xE0) >> 2) | ((src[2] & 0xE0) >> 5);
+                *dest++ = candidate_cache[cache_key][row_pattern[(p.x + i) & 0b11]];
+                src += 3;
+            }
+        }
+    }
 
     void PicoGraphics_PenP8::scanline_convert(PenType type, conversion_callback_func callback) {
+        scanline_convert(type, bounds, callback);
+    }
+    void PicoGraphics_PenP8::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+        Rect r = region.intersection(bounds);
+        if(r.empty()) return;
+
+        // Treat our void* frame_buffer as uint8_t
+        uint8_t *src = (uint8_t *)frame_buffer;
+
         if(type == PEN_RGB565) {
             // Cache the RGB888 palette as RGB565
             RGB565 cache[palette_size];
@@ -106,18 +154,21 @@ namespace pimoroni {
                 cache[i] = palette[i].to_rgb565();
             }
 
-            // Treat our void* frame_buffer as uint8_t
-            uint8_t *src = (uint8_t *)frame_buffer;
-
             // Allocate a per-row temporary buffer
-            uint16_t row_buf[bounds.w];
-            for(auto y = 0; y < bounds.h; y++) {
-                for(auto x = 0; x < bounds.w; x++) {
-                    row_buf[x] = cache[src[bounds.w * y + x]];
+            uint16_t row_buf[r.w];
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                uint8_t *row = &src[bounds.w * y + r.x];
+                for(auto x = 0; x < r.w; x++) {
+                    row_buf[x] = cache[row[x]];
                 }
                 // Callback to the driver with the row data
-                callback(row_buf, bounds.w * sizeof(RGB565));
+                callback(row_buf, r.w * sizeof(RGB565));
+            }
+        } else if(type == PEN_P8) {
+            // Already in the right format, hand over the framebuffer rows
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                callback(&src[bounds.w * y + r.x], r.w);
             }
         }
     }
-}
\ No newline at end of file
+}
@@ -15,6 +15,9 @@ namespace pimoroni {
     void PicoGraphics_PenRGB332::set_pen(uint8_t r, uint8_t g, uint8_t b) {
         color = rgb_to_rgb332(r, g, b);
     }
+    uint PicoGraphics_PenRGB332::get_pen() {
+        return color;
+    }
     int PicoGraphics_PenRGB332::create_pen(uint8_t r, uint8_t g, uint8_t b) {
         return rgb_to_rgb332(r, g, b);
     }
@@ -31,9 +34,13 @@ namespace pimoroni {
             *buf++ = color;
         }
     }
-    void PicoGraphics_PenRGB332::set_pixel_dither(const Point &p, const RGB &c) {
-        if(!bounds.contains(p)) return;
-        static uint8_t _odm[16] = {
+    uint PicoGraphics_PenRGB332::get_pixel(const Point &p) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        return buf[p.y * bounds.w + p.x];
+    }
+    // ordered dither of an RGB888 colour to RGB332
+    static uint8_t dither_rgb332(const Point &p, const RGB &c) {
+        static const uint8_t _odm[16] = {
             0,  8,  2, 10,
             12,  4, 14,  6,
             3, 11,  1,  9,
@@ -54,11 +61,15 @@ namespace pimoroni {
         uint8_t blu_r = c.b & 0b1111111;       // Remaining seven bits green
         blu_r >>= 3;                           // Discard down to four bit
 
-        color = red | grn | blu;
+        uint8_t color = red | grn | blu;
         if(red_r > _dmv) color |= 0b00100000;
         if(grn_r > _dmv) color |= 0b00000100;
         if(blu_r > _dmv) color |= 0b00000001;
-
+        return color;
+    }
+    void PicoGraphics_PenRGB332::set_pixel_dither(const Point &p, const RGB &c) {
+        if(!bounds.contains(p)) return;
+        color = dither_rgb332(p, c);
         set_pixel(p);
     }
     void PicoGraphics_PenRGB332::set_pixel_dither(const Point &p, const RGB565 &c) {
@@ -91,26 +102,70 @@ namespace pimoroni {
 
         set_pixel(p);
     }
+    void PicoGraphics_PenRGB332::copy_pixel_rect(const Rect &src, const Point &dest) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        // copy rows in whichever order avoids overwriting rows not yet copied
+        for(auto i = 0; i < src.h; i++) {
+            int32_t row = dest.y > src.y ? src.h - 1 - i : i;
+            memmove(&buf[(dest.y + row) * bounds.w + dest.x], &buf[(src.y + row) * bounds.w + src.x], src.w);
+        }
+    }
+    void PicoGraphics_PenRGB332::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        buf = &buf[p.y * bounds.w + p.x];
+
+        if(src_format == PEN_RGB332) {
+            memcpy(buf, &src[offset], l);
+        } else if(src_format == PEN_RGB888) {
+            // dithered the same as gradients and set_pixel_dither
+            src += offset * 3;
+            for(auto i = 0u; i < l; i++) {
+                *buf++ = dither_rgb332(Point(p.x + i, p.y), RGB(src[0], src[1], src[2]));
+                src += 3;
+            }
+        }
+    }
     void PicoGraphics_PenRGB332::scanline_convert(PenType type, conversion_callback_func callback) {
-        if(type == PEN_RGB565) {
+        scanline_convert(type, bounds, callback);
+    }
+    void PicoGraphics_PenRGB332::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+        Rect r = region.intersection(bounds);
+        if(r.empty()) return;
 
-            // Treat our void* frame_buffer as uint8_t
-            uint8_t *src = (uint8_t *)frame_buffer;
+        // Treat our void* frame_buffer as uint8_t
+        uint8_t *src = (uint8_t *)frame_buffer;
 
+        if(type == PEN_RGB565) {
             // Allocate a per-row temporary buffer
-            uint16_t row_buf[bounds.w];
-            for(auto y = 0; y < bounds.h; y++) {
-                for(auto x = 0; x < bounds.w; x++) {
-                    row_buf[x] = rgb332_to_rgb565_lut[*src];
-
-                    src++;
+            uint16_t row_buf[r.w];
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                uint8_t *row = &src[bounds.w * y + r.x];
+                for(auto x = 0; x < r.w; x++) {
+                    row_buf[x] = rgb332_to_rgb565_lut[row[x]];
                 }
                 // Callback to the driver with the row data
-                callback(row_buf, bounds.w * sizeof(RGB565));
+                callback(row_buf, r.w * sizeof(RGB565));
+            }
+        } else if(type == PEN_RGB332) {
+            // Already in the right format, hand over the framebuffer rows
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                callback(&src[bounds.w * y + r.x], r.w);
             }
         }
     }
+    void PicoGraphics_PenRGB332::set_pixel_alpha(const Point &p, const uint8_t alpha) {
+        uint8_t *buf = (uint8_t *)frame_buffer;
+        RGB bg((RGB332)buf[p.y * bounds.w + p.x]);
+        RGB fg((RGB332)color);
+        buf[p.y * bounds.w + p.x] = RGB(
+            bg.r + (fg.r - bg.r) * alpha / 255,
+            bg.g + (fg.g - bg.g) * alpha / 255,
+            bg.b + (fg.b - bg.b) * alpha / 255).to_rgb332();
+    }
     void PicoGraphics_PenRGB332::sprite(void* data, const Point &sprite, const Point &dest, const int scale, const int transparent) {
+        // sprite in screen bounds?
+        if(Rect(dest.x, dest.y, 8 * scale, 8 * scale).intersection(clip).empty()) return;
+
         //int sprite_x = (sprite & 0x0f) << 3;
         //int sprite_y = (sprite & 0xf0) >> 1;
         Point s {
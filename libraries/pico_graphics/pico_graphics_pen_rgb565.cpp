@@ -1,4 +1,5 @@
 #include "pico_graphics.hpp"
+#include <string.h>
 
 namespace pimoroni {
     PicoGraphics_PenRGB565::PicoGraphics_PenRGB565(uint16_t width, uint16_t height, void *frame_buffer)
@@ -15,6 +16,9 @@ namespace pimoroni {
         src_color = {r, g, b};
         color = src_color.to_rgb565();
     }
+    uint PicoGraphics_PenRGB565::get_pen() {
+        return color;
+    }
     int PicoGraphics_PenRGB565::create_pen(uint8_t r, uint8_t g, uint8_t b) {
         return RGB(r, g, b).to_rgb565();
     }
@@ -31,4 +35,55 @@ namespace pimoroni {
             *buf++ = color;
         }
     }
+    uint PicoGraphics_PenRGB565::get_pixel(const Point &p) {
+        uint16_t *buf = (uint16_t *)frame_buffer;
+        return buf[p.y * bounds.w + p.x];
+    }
+    void PicoGraphics_PenRGB565::set_pixel_dither(const Point &p, const RGB &c) {
+        if(!bounds.contains(p)) return;
+        // no need to dither, every colour is close enough to exact
+        color = RGB(c).to_rgb565();
+        set_pixel(p);
+    }
+    void PicoGraphics_PenRGB565::set_pixel_alpha(const Point &p, const uint8_t alpha) {
+        uint16_t *buf = (uint16_t *)frame_buffer;
+        buf[p.y * bounds.w + p.x] = blend_rgb565(buf[p.y * bounds.w + p.x], color, alpha);
+    }
+    void PicoGraphics_PenRGB565::copy_pixel_rect(const Rect &src, const Point &dest) {
+        uint16_t *buf = (uint16_t *)frame_buffer;
+        // copy rows in whichever order avoids overwriting rows not yet copied
+        for(auto i = 0; i < src.h; i++) {
+            int32_t row = dest.y > src.y ? src.h - 1 - i : i;
+            memmove(&buf[(dest.y + row) * bounds.w + dest.x], &buf[(src.y + row) * bounds.w + src.x], src.w * sizeof(RGB565));
+        }
+    }
+    void PicoGraphics_PenRGB565::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+        uint16_t *buf = (uint16_t *)frame_buffer;
+        buf = &buf[p.y * bounds.w + p.x];
+
+        if(src_format == PEN_RGB565) {
+            memcpy(buf, &src[offset * sizeof(RGB565)], l * sizeof(RGB565));
+        } else if(src_format == PEN_RGB888) {
+            src += offset * 3;
+            while(l--) {
+                *buf++ = RGB(src[0], src[1], src[2]).to_rgb565();
+                src += 3;
+            }
+        }
+    }
+    void PicoGraphics_PenRGB565::scanline_convert(PenType type, conversion_callback_func callback) {
+        scanline_convert(type, bounds, callback);
+    }
+    void PicoGraphics_PenRGB565::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+        Rect r = region.intersection(bounds);
+        if(r.empty()) return;
+
+        if(type == PEN_RGB565) {
+            // Already in the right format, hand over the framebuffer rows
+            uint16_t *buf = (uint16_t *)frame_buffer;
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                callback(&buf[bounds.w * y + r.x], r.w * sizeof(RGB565));
+            }
+        }
+    }
 }
\ No newline at end of file
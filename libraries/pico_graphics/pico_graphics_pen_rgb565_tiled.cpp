@@ -0,0 +1,251 @@
+#include "pico_graphics.hpp"
+#include <string.h>
+
+namespace pimoroni {
+    PicoGraphics_PenRGB565Tiled::PicoGraphics_PenRGB565Tiled(uint16_t width, uint16_t height, void *frame_buffer, uint16_t pool_tiles)
+    : PicoGraphics(width, height, frame_buffer) {
+        this->pen_type = PEN_RGB565_TILED;
+        this->tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+        this->tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+        this->pool_tiles = pool_tiles == 0 ? default_pool_tiles(width, height) : pool_tiles;
+        if(this->frame_buffer == nullptr) {
+            this->frame_buffer = (void *)(new uint8_t[buffer_size(width, height, this->pool_tiles)]);
+        }
+        set_framebuffer(this->frame_buffer);
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pen(uint c) {
+        color = c;
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pen(uint8_t r, uint8_t g, uint8_t b) {
+        src_color = {r, g, b};
+        color = src_color.to_rgb565();
+    }
+    uint PicoGraphics_PenRGB565Tiled::get_pen() {
+        return color;
+    }
+    int PicoGraphics_PenRGB565Tiled::create_pen(uint8_t r, uint8_t g, uint8_t b) {
+        return RGB(r, g, b).to_rgb565();
+    }
+    void PicoGraphics_PenRGB565Tiled::set_framebuffer(void *frame_buffer) {
+        this->frame_buffer = frame_buffer;
+        if(frame_buffer == nullptr) return;
+
+        // carve the buffer up into the tile pool followed by the tile tables
+        uint tiles = tiles_x * tiles_y;
+        pool       = (RGB565 *)frame_buffer;
+        tile_color = pool + pool_tiles * TILE_PIXELS;
+        tile_slot  = (uint16_t *)(tile_color + tiles);
+        free_slots = tile_slot + tiles;
+
+        reset_tiles();
+    }
+    void PicoGraphics_PenRGB565Tiled::reset_tiles() {
+        uint tiles = tiles_x * tiles_y;
+        for(auto i = 0u; i < tiles; i++) {
+            tile_color[i] = 0;
+            tile_slot[i] = TILE_SOLID;
+        }
+        // hand out low slots first
+        for(auto i = 0u; i < pool_tiles; i++) {
+            free_slots[i] = pool_tiles - 1 - i;
+        }
+        free_count = pool_tiles;
+        pool_exhausted = false;
+    }
+    RGB565 *PicoGraphics_PenRGB565Tiled::expand_tile(uint t) {
+        if(tile_slot[t] != TILE_SOLID) return &pool[tile_slot[t] * TILE_PIXELS];
+
+        if(free_count == 0) {
+            // no room to store this tile's pixels, the write is dropped
+            pool_exhausted = true;
+            return nullptr;
+        }
+
+        uint16_t slot = free_slots[--free_count];
+        RGB565 *tile = &pool[slot * TILE_PIXELS];
+        RGB565 c = tile_color[t];
+        for(auto i = 0u; i < TILE_PIXELS; i++) {
+            tile[i] = c;
+        }
+        tile_slot[t] = slot;
+        return tile;
+    }
+    void PicoGraphics_PenRGB565Tiled::release_tile(uint t) {
+        if(tile_slot[t] == TILE_SOLID) return;
+        free_slots[free_count++] = tile_slot[t];
+        tile_slot[t] = TILE_SOLID;
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pixel(const Point &p) {
+        uint t = (p.y / TILE_SIZE) * tiles_x + (p.x / TILE_SIZE);
+
+        // nothing to do if the pixel lands on a solid tile of the same colour
+        if(tile_slot[t] == TILE_SOLID && tile_color[t] == color) return;
+
+        RGB565 *tile = expand_tile(t);
+        if(tile == nullptr) return;
+
+        tile[(p.y % TILE_SIZE) * TILE_SIZE + (p.x % TILE_SIZE)] = color;
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pixel_span(const Point &p, uint l) {
+        uint row = (p.y / TILE_SIZE) * tiles_x;
+        uint ry = (p.y % TILE_SIZE) * TILE_SIZE;
+        int32_t x = p.x;
+
+        // walk the span one tile at a time
+        while(l) {
+            uint tx = x % TILE_SIZE;
+            uint run = std::min(l, TILE_SIZE - tx);
+            uint t = row + (x / TILE_SIZE);
+
+            if(tile_slot[t] != TILE_SOLID || tile_color[t] != color) {
+                RGB565 *tile = expand_tile(t);
+                if(tile != nullptr) {
+                    RGB565 *dest = &tile[ry + tx];
+                    for(auto i = 0u; i < run; i++) {
+                        *dest++ = color;
+                    }
+                }
+            }
+
+            x += run;
+            l -= run;
+        }
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pixel_rect(const Rect &r) {
+        int32_t ty1 = r.y / TILE_SIZE;
+        int32_t ty2 = (r.y + r.h - 1) / TILE_SIZE;
+        int32_t tx1 = r.x / TILE_SIZE;
+        int32_t tx2 = (r.x + r.w - 1) / TILE_SIZE;
+
+        for(auto ty = ty1; ty <= ty2; ty++) {
+            for(auto tx = tx1; tx <= tx2; tx++) {
+                uint t = ty * tiles_x + tx;
+
+                // the on-screen part of this tile (edge tiles may be cut short)
+                Rect tile_rect = Rect(tx * TILE_SIZE, ty * TILE_SIZE, TILE_SIZE, TILE_SIZE).intersection(bounds);
+                Rect part = tile_rect.intersection(r);
+
+                if(part.w == tile_rect.w && part.h == tile_rect.h) {
+                    // tile fully covered, collapse it back to a solid colour
+                    release_tile(t);
+                    tile_color[t] = color;
+                    continue;
+                }
+
+                if(tile_slot[t] == TILE_SOLID && tile_color[t] == color) continue;
+
+                RGB565 *tile = expand_tile(t);
+                if(tile == nullptr) continue;
+
+                for(auto y = part.y; y < part.y + part.h; y++) {
+                    RGB565 *dest = &tile[(y % TILE_SIZE) * TILE_SIZE + (part.x % TILE_SIZE)];
+                    for(auto i = 0; i < part.w; i++) {
+                        *dest++ = color;
+                    }
+                }
+            }
+        }
+    }
+    uint PicoGraphics_PenRGB565Tiled::get_pixel(const Point &p) {
+        uint t = (p.y / TILE_SIZE) * tiles_x + (p.x / TILE_SIZE);
+        if(tile_slot[t] == TILE_SOLID) return tile_color[t];
+        return pool[tile_slot[t] * TILE_PIXELS + (p.y % TILE_SIZE) * TILE_SIZE + (p.x % TILE_SIZE)];
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pixel_dither(const Point &p, const RGB &c) {
+        if(!bounds.contains(p)) return;
+        color = RGB(c).to_rgb565();
+        set_pixel(p);
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pixel_alpha(const Point &p, const uint8_t alpha) {
+        // write the blended colour through set_pixel so that the tile is
+        // expanded if needed, without changing the pen
+        RGB565 pen = color;
+        color = blend_rgb565(get_pixel(p), pen, alpha);
+        set_pixel(p);
+        color = pen;
+    }
+    void PicoGraphics_PenRGB565Tiled::copy_pixel_rect(const Rect &src, const Point &dest) {
+        RGB565 saved = color;
+        uint16_t row_buf[src.w];
+        for(auto i = 0; i < src.h; i++) {
+            int32_t row = dest.y > src.y ? src.h - 1 - i : i;
+
+            // read the row out first, the source and destination may overlap
+            scanline_convert(PEN_RGB565, Rect(src.x, src.y + row, src.w, 1), [&row_buf](void *data, size_t length) {
+                memcpy(row_buf, data, length);
+            });
+
+            // write it back as runs of the same colour, so that solid tiles
+            // stay solid wherever possible
+            for(auto x = 0; x < src.w;) {
+                int32_t run = 1;
+                while(x + run < src.w && row_buf[x + run] == row_buf[x]) run++;
+                color = row_buf[x];
+                set_pixel_span(Point(dest.x + x, dest.y + row), run);
+                x += run;
+            }
+        }
+        color = saved;
+    }
+    void PicoGraphics_PenRGB565Tiled::set_pixel_row(const Point &p, uint l, const uint8_t *src, uint offset, PenType src_format) {
+        // convert the row first, then write it as runs of the same colour so
+        // that solid tiles stay solid wherever possible
+        uint16_t row_buf[l];
+        if(src_format == PEN_RGB565 || src_format == PEN_RGB565_TILED) {
+            memcpy(row_buf, &src[offset * sizeof(RGB565)], l * sizeof(RGB565));
+        } else if(src_format == PEN_RGB888) {
+            src += offset * 3;
+            for(auto i = 0u; i < l; i++) {
+                row_buf[i] = RGB(src[0], src[1], src[2]).to_rgb565();
+                src += 3;
+            }
+        } else {
+            return;
+        }
+
+        RGB565 saved = color;
+        for(auto x = 0u; x < l;) {
+            uint run = 1;
+            while(x + run < l && row_buf[x + run] == row_buf[x]) run++;
+            color = row_buf[x];
+            set_pixel_span(Point(p.x + x, p.y), run);
+            x += run;
+        }
+        color = saved;
+    }
+    void PicoGraphics_PenRGB565Tiled::scanline_convert(PenType type, conversion_callback_func callback) {
+        scanline_convert(type, bounds, callback);
+    }
+    void PicoGraphics_PenRGB565Tiled::scanline_convert(PenType type, const Rect &region, conversion_callback_func callback) {
+        Rect r = region.intersection(bounds);
+        if(r.empty()) return;
+
+        if(type == PEN_RGB565) {
+            // Allocate a per-row temporary buffer
+            uint16_t row_buf[r.w];
+            for(auto y = r.y; y < r.y + r.h; y++) {
+                uint16_t *dest = row_buf;
+                uint t = (y / TILE_SIZE) * tiles_x + r.x / TILE_SIZE;
+                uint ry = (y % TILE_SIZE) * TILE_SIZE;
+
+                for(auto x = r.x; x < r.x + r.w; t++) {
+                    uint tx = x % TILE_SIZE;
+                    uint w = std::min((uint)(r.x + r.w - x), TILE_SIZE - tx);
+                    if(tile_slot[t] == TILE_SOLID) {
+                        // expand solid tiles on the fly
+                        RGB565 c = tile_color[t];
+                        for(auto i = 0u; i < w; i++) {
+                            dest[i] = c;
+                        }
+                    } else {
+                        memcpy(dest, &pool[tile_slot[t] * TILE_PIXELS + ry + tx], w * sizeof(RGB565));
+                    }
+                    dest += w;
+                    x += w;
+                }
+                // Callback to the driver with the row data
+                callback(row_buf, r.w * sizeof(RGB565));
+            }
+        }
+    }
+}
@@ -0,0 +1,197 @@
+#include <cstring>
+
+#include "pico_graphics.hpp"
+
+namespace pimoroni {
+
+  TextCache::TextCache(size_t pool_size, void *pool) : pool((uint8_t *)pool), pool_size(pool_size) {
+    if(this->pool == nullptr) {
+      this->pool = new uint8_t[pool_size];
+    }
+  }
+
+  void TextCache::clear() {
+    for(auto &e : entries) {
+      e.used = false;
+      e.text.clear();
+    }
+  }
+
+  static const void *current_font(const PicoGraphics &g) {
+    return g.bitmap_font ? (const void *)g.bitmap_font : (const void *)g.hershey_font;
+  }
+
+  static size_t mask_size(const TextCache::Entry &e) {
+    return (e.w / 8) * e.h;
+  }
+
+  TextCache::Entry *TextCache::find(PicoGraphics &g, const std::string &t, int32_t wrap, float s, float a, uint8_t letter_spacing) {
+    const void *font = current_font(g);
+    for(auto &e : entries) {
+      if(e.used && e.font == font && e.wrap == wrap && e.scale == s && e.angle == a
+        && e.letter_spacing == letter_spacing && e.text == t) {
+        return &e;
+      }
+    }
+    return nullptr;
+  }
+
+  TextCache::Entry *TextCache::allocate(size_t size) {
+    if(size > pool_size) return nullptr;
+
+    while(true) {
+      // masks already in the pool in address order, and a spare entry
+      Entry *sorted[MAX_ENTRIES];
+      uint count = 0;
+      Entry *spare = nullptr;
+      for(auto &e : entries) {
+        if(!e.used) {
+          if(!spare) spare = &e;
+          continue;
+        }
+        uint i = count++;
+        while(i > 0 && sorted[i - 1]->start > e.start) {
+          sorted[i] = sorted[i - 1];
+          i--;
+        }
+        sorted[i] = &e;
+      }
+
+      // first gap that the mask fits in
+      if(spare) {
+        size_t start = 0;
+        for(uint i = 0; i <= count; i++) {
+          size_t end = i < count ? sorted[i]->start : pool_size;
+          if(end - start >= size) {
+            spare->start = start;
+            return spare;
+          }
+          if(i < count) start = sorted[i]->start + mask_size(*sorted[i]);
+        }
+      }
+
+      // no room, drop the least recently used mask and try again
+      Entry *oldest = nullptr;
+      for(auto &e : entries) {
+        if(e.used && (!oldest || e.last_used < oldest->last_used)) oldest = &e;
+      }
+      if(!oldest) return nullptr;
+      oldest->used = false;
+      oldest->text.clear();
+    }
+  }
+
+  TextCache::Entry *TextCache::render(PicoGraphics &g, const std::string &t, int32_t wrap, float s, float a, uint8_t letter_spacing) {
+    // find the area covered by the text, relative to its origin
+    int32_t x1 = INT32_MAX, y1 = INT32_MAX, x2 = INT32_MIN, y2 = INT32_MIN;
+    auto extend = [&](int32_t ax, int32_t ay, int32_t bx, int32_t by) {
+      x1 = std::min(x1, std::min(ax, bx)); x2 = std::max(x2, std::max(ax, bx));
+      y1 = std::min(y1, std::min(ay, by)); y2 = std::max(y2, std::max(ay, by));
+    };
+
+    if(g.bitmap_font) {
+      bitmap::text(g.bitmap_font, [&](int32_t x, int32_t y, int32_t w, int32_t h) {
+        extend(x, y, x + w - 1, y + h - 1);
+      }, t, 0, 0, wrap, s, letter_spacing);
+    } else if(g.hershey_font) {
+      hershey::text(g.hershey_font, [&](int32_t ax, int32_t ay, int32_t bx, int32_t by) {
+        extend(ax, ay, bx, by);
+      }, t, 0, 0, s, a);
+    }
+
+    if(x1 > x2 || y1 > y2) return nullptr;
+
+    // rows are padded out to whole bytes to suit the 1-bit pen
+    int32_t w = (x2 - x1 + 1 + 7) & ~7;
+    int32_t h = y2 - y1 + 1;
+    if(w > UINT16_MAX || h > UINT16_MAX) return nullptr;
+
+    Entry *e = allocate((w / 8) * h);
+    if(!e) return nullptr;
+
+    e->used = true;
+    e->text = t;
+    e->font = current_font(g);
+    e->wrap = wrap;
+    e->scale = s;
+    e->angle = a;
+    e->letter_spacing = letter_spacing;
+    e->offset = Point(x1, y1);
+    e->w = w;
+    e->h = h;
+
+    // draw the text into the mask through the normal text pipeline
+    memset(pool + e->start, 0, mask_size(*e));
+    PicoGraphics_Pen1Bit mask(w, h, pool + e->start);
+    if(g.bitmap_font) {
+      mask.set_font(g.bitmap_font);
+    } else {
+      mask.set_font(g.hershey_font);
+    }
+    mask.set_pen(1);
+    mask.text(t, -e->offset, wrap, s, a, letter_spacing);
+
+    return e;
+  }
+
+  void TextCache::blit(PicoGraphics &g, const Entry &e, const Point &p) {
+    Rect area(p.x + e.offset.x, p.y + e.offset.y, e.w, e.h);
+    Rect clipped = area.intersection(g.clip);
+    if(clipped.empty()) return;
+
+    // draws each run of set bits as a span, skipping whole bytes that are
+    // empty or that continue a run
+    uint stride = e.w / 8;
+    for(int32_t y = clipped.y; y < clipped.y + clipped.h; y++) {
+      const uint8_t *row = pool + e.start + (y - area.y) * stride;
+      int32_t run = -1;
+      for(uint bx = 0; bx < stride; bx++) {
+        uint8_t b = row[bx];
+        if(b == 0x00 && run < 0) continue;
+        if(b == 0xff && run >= 0) continue;
+
+        int32_t x = bx * 8;
+        for(int32_t bit = 0; bit < 8; bit++) {
+          bool set = b & (0x80 >> bit);
+          if(set && run < 0) {
+            run = x + bit;
+          } else if(!set && run >= 0) {
+            g.pixel_span(Point(area.x + run, y), x + bit - run);
+            run = -1;
+          }
+        }
+      }
+      if(run >= 0) g.pixel_span(Point(area.x + run, y), e.w - run);
+    }
+  }
+
+  void TextCache::text(PicoGraphics &g, const std::string &t, const Point &p, int32_t wrap, float s, float a, uint8_t letter_spacing) {
+    // a 1-bit mask would lose the edges of anti-aliased fonts
+    if(g.alpha_font) {
+      g.text(t, p, wrap, s, a, letter_spacing);
+      return;
+    }
+
+    // bitmap fonts only come in whole number scales, so text that would be
+    // drawn the same shares a mask
+    if(g.bitmap_font) s = PicoGraphics::bitmap_scale(s);
+
+    Entry *e = find(g, t, wrap, s, a, letter_spacing);
+    if(e) {
+      hits++;
+    } else {
+      misses++;
+      e = render(g, t, wrap, s, a, letter_spacing);
+    }
+
+    // too big for the pool (or nothing to draw), fall back to the fonts
+    if(!e) {
+      g.text(t, p, wrap, s, a, letter_spacing);
+      return;
+    }
+
+    e->last_used = ++clock;
+    blit(g, *e, p);
+  }
+
+}
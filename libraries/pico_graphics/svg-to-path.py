@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Converts the paths in an SVG file into the compact binary path format used by
+PicoGraphics::fill_path and PicoGraphics::stroke_path.
+
+Supports the M, L, H, V, Q, T, C, S and Z path commands (absolute and
+relative). Arcs and transforms are not supported, convert them to curves in
+your editor first.
+
+Outputs either a raw binary file for MicroPython or a .hpp file containing a
+const array that stays in flash when compiled into a C++ project.
+"""
+
+import re
+import struct
+import argparse
+import xml.etree.ElementTree as ET
+from pathlib import Path
+
+
+MAGIC = ord('P')
+EVEN_ODD = 0b1
+
+MOVE, LINE, QUAD, CUBIC, CLOSE = range(5)
+RELATIVE = 0x80
+
+
+parser = argparse.ArgumentParser(description='Converts SVG paths into the binary path format used by PicoGraphics.')
+parser.add_argument('file', nargs="+", help='input files to convert')
+parser.add_argument('--out_dir', type=Path, default=None, help='output directory')
+parser.add_argument('--hpp', action="store_true", help='output .hpp file for C++ embedding')
+parser.add_argument('--scale', type=float, default=1.0, help='scale applied to all coordinates')
+parser.add_argument('--even-odd', action="store_true", help='fill using the even-odd rule (default is non-zero)')
+
+options = parser.parse_args()
+
+
+def tokenise(d):
+    for command, args in re.findall(r'([MmLlHhVvQqTtCcSsZzAa])([^MmLlHhVvQqTtCcSsZzAa]*)', d):
+        numbers = [float(n) for n in re.findall(r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?', args)]
+        yield command, numbers
+
+
+def parse_path(d):
+    """Converts an SVG path string into a list of (command, [(x, y), ...]) in absolute coordinates."""
+    out = []
+    x = y = 0.0
+    start = (0.0, 0.0)
+    control = None  # last control point, for the smooth curve commands
+    previous = None
+
+    for command, numbers in tokenise(d):
+        relative = command.islower()
+        c = command.upper()
+
+        def point(i):
+            px, py = numbers[i], numbers[i + 1]
+            return (x + px, y + py) if relative else (px, py)
+
+        if c == 'Z':
+            out.append((CLOSE, []))
+            x, y = start
+            control = None
+            previous = c
+            continue
+
+        if c == 'A':
+            raise ValueError("arcs are not supported, convert them to curves first")
+
+        step = {'M': 2, 'L': 2, 'H': 1, 'V': 1, 'Q': 4, 'T': 2, 'C': 6, 'S': 4}[c]
+        for i in range(0, len(numbers), step):
+            if c == 'M':
+                p = point(i)
+                # subsequent pairs after a move are implicit lines
+                out.append((MOVE if i == 0 else LINE, [p]))
+                if i == 0:
+                    start = p
+                control = None
+            elif c == 'L':
+                p = point(i)
+                out.append((LINE, [p]))
+                control = None
+            elif c == 'H':
+                p = (x + numbers[i] if relative else numbers[i], y)
+                out.append((LINE, [p]))
+                control = None
+            elif c == 'V':
+                p = (x, y + numbers[i] if relative else numbers[i])
+                out.append((LINE, [p]))
+                control = None
+            elif c == 'Q':
+                c1, p = point(i), point(i + 2)
+                out.append((QUAD, [c1, p]))
+                control = c1
+            elif c == 'T':
+                c1 = (2 * x - control[0], 2 * y - control[1]) if control and previous in 'QT' else (x, y)
+                p = point(i)
+                out.append((QUAD, [c1, p]))
+                control = c1
+            elif c == 'C':
+                c1, c2, p = point(i), point(i + 2), point(i + 4)
+                out.append((CUBIC, [c1, c2, p]))
+                control = c2
+            elif c == 'S':
+                c1 = (2 * x - control[0], 2 * y - control[1]) if control and previous in 'CS' else (x, y)
+                c2, p = point(i), point(i + 2)
+                out.append((CUBIC, [c1, c2, p]))
+                control = c2
+            x, y = p
+            previous = c
+
+    return out
+
+
+def encode(commands, width, height, flags):
+    data = bytearray(struct.pack("<BBHH", MAGIC, flags, width, height))
+    last = (0, 0)
+
+    for command, points in commands:
+        # coordinates are stored in 1/16ths of a pixel
+        fixed = [(round(px * options.scale * 16), round(py * options.scale * 16)) for px, py in points]
+
+        deltas = []
+        previous = last
+        for px, py in fixed:
+            deltas.append((px - previous[0], py - previous[1]))
+            previous = (px, py)
+
+        if fixed and all(-128 <= dx <= 127 and -128 <= dy <= 127 for dx, dy in deltas):
+            data.append(command | RELATIVE)
+            for dx, dy in deltas:
+                data += struct.pack("<bb", dx, dy)
+        else:
+            data.append(command)
+            for px, py in fixed:
+                if not (-32768 <= px <= 32767 and -32768 <= py <= 32767):
+                    raise ValueError("path coordinates out of range, try a smaller --scale")
+                data += struct.pack("<hh", px, py)
+
+        if fixed:
+            last = fixed[-1]
+
+    return bytes(data)
+
+
+def convert(svg_path):
+    tree = ET.parse(svg_path)
+    root = tree.getroot()
+
+    width = root.get("width")
+    height = root.get("height")
+    view_box = root.get("viewBox")
+    if view_box:
+        _, _, width, height = view_box.replace(",", " ").split()
+    width = round(float(re.sub(r'[^\d.]', '', width or "0")) * options.scale)
+    height = round(float(re.sub(r'[^\d.]', '', height or "0")) * options.scale)
+
+    commands = []
+    for element in root.iter():
+        if element.tag.split('}')[-1] == 'path' and element.get("d"):
+            commands += parse_path(element.get("d"))
+
+    flags = EVEN_ODD if options.even_odd else 0
+    return encode(commands, width, height, flags), width, height
+
+
+for input_filename in options.file:
+    input_path = Path(input_filename)
+    data, width, height = convert(input_path)
+
+    output_dir = options.out_dir or input_path.parent
+
+    if options.hpp:
+        name = re.sub(r'\W', '_', input_path.stem)
+        output_path = output_dir / (input_path.stem + ".hpp")
+        with open(output_path, "w") as f:
+            f.write("#pragma once\n\n#include <cstdint>\n\n")
+            f.write(f"// {width}x{height} path converted from {input_path.name} by svg-to-path.py\n")
+            f.write(f"static const uint8_t {name}_path[{len(data)}] = {{\n")
+            for i in range(0, len(data), 16):
+                f.write("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",\n")
+            f.write("};\n")
+    else:
+        output_path = output_dir / (input_path.stem + ".path")
+        with open(output_path, "wb") as f:
+            f.write(data)
+
+    print(f"Converted: {input_path} {width}x{height} {len(data)} bytes")
+    print(f"Written to: {output_path}")
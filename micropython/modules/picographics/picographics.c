@@ -9,6 +9,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(ModPicoGraphics_get_required_buffer_size_obj, M
 
 // Class Methods
 MP_DEFINE_CONST_FUN_OBJ_1(ModPicoGraphics_update_obj, ModPicoGraphics_update);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_partial_update_obj, 5, 5, ModPicoGraphics_partial_update);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_queue_update_obj, 5, 5, ModPicoGraphics_queue_update);
+MP_DEFINE_CONST_FUN_OBJ_1(ModPicoGraphics_update_queued_obj, ModPicoGraphics_update_queued);
 MP_DEFINE_CONST_FUN_OBJ_2(ModPicoGraphics_set_backlight_obj, ModPicoGraphics_set_backlight);
 
 // Palette management
@@ -23,17 +26,33 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_create_pen_obj, 4, 4, ModPic
 // Primitives
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_set_clip_obj, 5, 5, ModPicoGraphics_set_clip);
 MP_DEFINE_CONST_FUN_OBJ_1(ModPicoGraphics_remove_clip_obj, ModPicoGraphics_remove_clip);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_push_clip_obj, 5, 5, ModPicoGraphics_push_clip);
+MP_DEFINE_CONST_FUN_OBJ_1(ModPicoGraphics_pop_clip_obj, ModPicoGraphics_pop_clip);
 MP_DEFINE_CONST_FUN_OBJ_1(ModPicoGraphics_clear_obj, ModPicoGraphics_clear);
 MP_DEFINE_CONST_FUN_OBJ_3(ModPicoGraphics_pixel_obj, ModPicoGraphics_pixel);
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_pixel_span_obj, 4, 4, ModPicoGraphics_pixel_span);
+MP_DEFINE_CONST_FUN_OBJ_3(ModPicoGraphics_get_pixel_obj, ModPicoGraphics_get_pixel);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_copy_rect_obj, 7, 7, ModPicoGraphics_copy_rect);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_scroll_obj, 7, 8, ModPicoGraphics_scroll);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_write_pixels_obj, 6, 7, ModPicoGraphics_write_pixels);
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_rectangle_obj, 5, 5, ModPicoGraphics_rectangle);
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_circle_obj, 4, 4, ModPicoGraphics_circle);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_circle_outline_obj, 4, 4, ModPicoGraphics_circle_outline);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_ellipse_obj, 5, 5, ModPicoGraphics_ellipse);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_ellipse_outline_obj, 5, 5, ModPicoGraphics_ellipse_outline);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_rounded_rectangle_obj, 6, 6, ModPicoGraphics_rounded_rectangle);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_arc_obj, 7, 7, ModPicoGraphics_arc);
+MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_linear_gradient_obj, 1, ModPicoGraphics_linear_gradient);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_radial_gradient_obj, 6, 6, ModPicoGraphics_radial_gradient);
 MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_character_obj, 1, ModPicoGraphics_character);
 MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_text_obj, 1, ModPicoGraphics_text);
 MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_measure_text_obj, 1, ModPicoGraphics_measure_text);
 MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_polygon_obj, 2, ModPicoGraphics_polygon);
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_triangle_obj, 7, 7, ModPicoGraphics_triangle);
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ModPicoGraphics_line_obj, 5, 5, ModPicoGraphics_line);
+MP_DEFINE_CONST_FUN_OBJ_3(ModPicoGraphics_flood_fill_obj, ModPicoGraphics_flood_fill);
+MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_fill_path_obj, 2, ModPicoGraphics_fill_path);
+MP_DEFINE_CONST_FUN_OBJ_KW(ModPicoGraphics_stroke_path_obj, 2, ModPicoGraphics_stroke_path);
 
 // Sprites
 MP_DEFINE_CONST_FUN_OBJ_2(ModPicoGraphics_set_spritesheet_obj, ModPicoGraphics_set_spritesheet);
@@ -56,17 +75,36 @@ STATIC const mp_rom_map_elem_t ModPicoGraphics_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&ModPicoGraphics_clear_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&ModPicoGraphics_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_partial_update), MP_ROM_PTR(&ModPicoGraphics_partial_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_queue_update), MP_ROM_PTR(&ModPicoGraphics_queue_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_update_queued), MP_ROM_PTR(&ModPicoGraphics_update_queued_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_clip), MP_ROM_PTR(&ModPicoGraphics_set_clip_obj) },
     { MP_ROM_QSTR(MP_QSTR_remove_clip), MP_ROM_PTR(&ModPicoGraphics_remove_clip_obj) },
+    { MP_ROM_QSTR(MP_QSTR_push_clip), MP_ROM_PTR(&ModPicoGraphics_push_clip_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pop_clip), MP_ROM_PTR(&ModPicoGraphics_pop_clip_obj) },
     { MP_ROM_QSTR(MP_QSTR_pixel_span), MP_ROM_PTR(&ModPicoGraphics_pixel_span_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_pixel), MP_ROM_PTR(&ModPicoGraphics_get_pixel_obj) },
+    { MP_ROM_QSTR(MP_QSTR_copy_rect), MP_ROM_PTR(&ModPicoGraphics_copy_rect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scroll), MP_ROM_PTR(&ModPicoGraphics_scroll_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_pixels), MP_ROM_PTR(&ModPicoGraphics_write_pixels_obj) },
     { MP_ROM_QSTR(MP_QSTR_rectangle), MP_ROM_PTR(&ModPicoGraphics_rectangle_obj) },
     { MP_ROM_QSTR(MP_QSTR_circle), MP_ROM_PTR(&ModPicoGraphics_circle_obj) },
+    { MP_ROM_QSTR(MP_QSTR_circle_outline), MP_ROM_PTR(&ModPicoGraphics_circle_outline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ellipse), MP_ROM_PTR(&ModPicoGraphics_ellipse_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ellipse_outline), MP_ROM_PTR(&ModPicoGraphics_ellipse_outline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_rounded_rectangle), MP_ROM_PTR(&ModPicoGraphics_rounded_rectangle_obj) },
+    { MP_ROM_QSTR(MP_QSTR_arc), MP_ROM_PTR(&ModPicoGraphics_arc_obj) },
+    { MP_ROM_QSTR(MP_QSTR_linear_gradient), MP_ROM_PTR(&ModPicoGraphics_linear_gradient_obj) },
+    { MP_ROM_QSTR(MP_QSTR_radial_gradient), MP_ROM_PTR(&ModPicoGraphics_radial_gradient_obj) },
     { MP_ROM_QSTR(MP_QSTR_character), MP_ROM_PTR(&ModPicoGraphics_character_obj) },
     { MP_ROM_QSTR(MP_QSTR_text), MP_ROM_PTR(&ModPicoGraphics_text_obj) },
     { MP_ROM_QSTR(MP_QSTR_measure_text), MP_ROM_PTR(&ModPicoGraphics_measure_text_obj) },
     { MP_ROM_QSTR(MP_QSTR_polygon), MP_ROM_PTR(&ModPicoGraphics_polygon_obj) },
     { MP_ROM_QSTR(MP_QSTR_triangle), MP_ROM_PTR(&ModPicoGraphics_triangle_obj) },
     { MP_ROM_QSTR(MP_QSTR_line), MP_ROM_PTR(&ModPicoGraphics_line_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flood_fill), MP_ROM_PTR(&ModPicoGraphics_flood_fill_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill_path), MP_ROM_PTR(&ModPicoGraphics_fill_path_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stroke_path), MP_ROM_PTR(&ModPicoGraphics_stroke_path_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_set_spritesheet), MP_ROM_PTR(&ModPicoGraphics_set_spritesheet_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_spritesheet), MP_ROM_PTR(&ModPicoGraphics_load_spritesheet_obj) },
@@ -122,10 +160,13 @@ STATIC const mp_map_elem_t picographics_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_DISPLAY_INKY_FRAME), MP_ROM_INT(DISPLAY_INKY_FRAME) },
 
     { MP_ROM_QSTR(MP_QSTR_PEN_1BIT), MP_ROM_INT(PEN_1BIT) },
+    { MP_ROM_QSTR(MP_QSTR_PEN_1BIT_PAGED), MP_ROM_INT(PEN_1BIT_PAGED) },
     { MP_ROM_QSTR(MP_QSTR_PEN_P4), MP_ROM_INT(PEN_P4) },
     { MP_ROM_QSTR(MP_QSTR_PEN_P8), MP_ROM_INT(PEN_P8) },
     { MP_ROM_QSTR(MP_QSTR_PEN_RGB332), MP_ROM_INT(PEN_RGB332) },
     { MP_ROM_QSTR(MP_QSTR_PEN_RGB565), MP_ROM_INT(PEN_RGB565) },
+    { MP_ROM_QSTR(MP_QSTR_PEN_RGB565_TILED), MP_ROM_INT(PEN_RGB565_TILED) },
+    { MP_ROM_QSTR(MP_QSTR_PEN_RGB888), MP_ROM_INT(PEN_RGB888) },
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_picographics_globals, picographics_globals_table);
 
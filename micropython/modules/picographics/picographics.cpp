@@ -76,6 +76,8 @@ bool get_display_settings(PicoGraphicsDisplay display, int &width, int &height,
             height = 128;
             if(rotate == -1) rotate = (int)Rotation::ROTATE_0;
             if(pen_type == -1) pen_type = PEN_1BIT;
+            // written a page of eight rows at a time, so store it the same way
+            if(pen_type == PEN_1BIT) pen_type = PEN_1BIT_PAGED;
             break;
         case DISPLAY_INKY_PACK:
             width = 296;
@@ -107,6 +109,10 @@ size_t get_required_buffer_size(PicoGraphicsPenType pen_type, uint width, uint h
             return PicoGraphics_PenRGB332::buffer_size(width, height);
         case PEN_RGB565:
             return PicoGraphics_PenRGB565::buffer_size(width, height);
+        case PEN_RGB565_TILED:
+            return PicoGraphics_PenRGB565Tiled::buffer_size(width, height);
+        case PEN_1BIT_PAGED:
+            return PicoGraphics_Pen1BitPaged::buffer_size(width, height);
         default:
             return 0;
     }
@@ -237,6 +243,12 @@ mp_obj_t ModPicoGraphics_make_new(const mp_obj_type_t *type, size_t n_args, size
         case PEN_RGB565:
             self->graphics = m_new_class(PicoGraphics_PenRGB565, self->display->width, self->display->height, self->buffer);
             break;
+        case PEN_RGB565_TILED:
+            self->graphics = m_new_class(PicoGraphics_PenRGB565Tiled, self->display->width, self->display->height, self->buffer);
+            break;
+        case PEN_1BIT_PAGED:
+            self->graphics = m_new_class(PicoGraphics_Pen1BitPaged, self->display->width, self->display->height, self->buffer);
+            break;
         default:
             break;
     }
@@ -401,6 +413,17 @@ mp_obj_t ModPicoGraphics_set_scanline_callback(mp_obj_t self_in, mp_obj_t cb_in)
 }
 */
 
+// The tiled pen drops drawing that doesn't fit in its tile pool, say so
+// once the frame has gone out rather than leave it looking half drawn
+static void check_tile_pool(ModPicoGraphics_obj_t *self) {
+    if(self->graphics->pen_type != PicoGraphics::PEN_RGB565_TILED) return;
+    PicoGraphics_PenRGB565Tiled *tiled = (PicoGraphics_PenRGB565Tiled *)self->graphics;
+    if(tiled->pool_exhausted) {
+        tiled->pool_exhausted = false;
+        mp_raise_msg(&mp_type_RuntimeError, "PicoGraphics: tile pool exhausted, some drawing was dropped");
+    }
+}
+
 mp_obj_t ModPicoGraphics_update(mp_obj_t self_in) {
     ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(self_in, ModPicoGraphics_obj_t);
 /*
@@ -422,7 +445,73 @@ mp_obj_t ModPicoGraphics_update(mp_obj_t self_in) {
     #endif
     }
 
-    self->display->update(self->graphics);
+    self->display->update_async(self->graphics);
+
+    while(self->display->is_busy()) {
+    #ifdef MICROPY_EVENT_POLL_HOOK
+    MICROPY_EVENT_POLL_HOOK
+    #endif
+    }
+
+    check_tile_pool(self);
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_partial_update(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    while(self->display->is_busy()) {
+    #ifdef MICROPY_EVENT_POLL_HOOK
+    MICROPY_EVENT_POLL_HOOK
+    #endif
+    }
+
+    self->display->partial_update_async(self->graphics, {
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    });
+
+    while(self->display->is_busy()) {
+    #ifdef MICROPY_EVENT_POLL_HOOK
+    MICROPY_EVENT_POLL_HOOK
+    #endif
+    }
+
+    check_tile_pool(self);
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_queue_update(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->display->queue_update({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    });
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_update_queued(mp_obj_t self_in) {
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(self_in, ModPicoGraphics_obj_t);
+
+    while(self->display->is_busy()) {
+    #ifdef MICROPY_EVENT_POLL_HOOK
+    MICROPY_EVENT_POLL_HOOK
+    #endif
+    }
+
+    self->display->update_queued(self->graphics);
 
     while(self->display->is_busy()) {
     #ifdef MICROPY_EVENT_POLL_HOOK
@@ -430,6 +519,8 @@ mp_obj_t ModPicoGraphics_update(mp_obj_t self_in) {
     #endif
     }
 
+    check_tile_pool(self);
+
     return mp_const_none;
 }
 
@@ -591,6 +682,27 @@ mp_obj_t ModPicoGraphics_remove_clip(mp_obj_t self_in) {
     return mp_const_none;
 }
 
+mp_obj_t ModPicoGraphics_push_clip(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    return self->graphics->push_clip({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    }) ? mp_const_true : mp_const_false;
+}
+
+mp_obj_t ModPicoGraphics_pop_clip(mp_obj_t self_in) {
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(self_in, ModPicoGraphics_obj_t);
+
+    self->graphics->pop_clip();
+
+    return mp_const_none;
+}
+
 mp_obj_t ModPicoGraphics_clear(mp_obj_t self_in) {
     ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(self_in, ModPicoGraphics_obj_t);
 
@@ -623,6 +735,87 @@ mp_obj_t ModPicoGraphics_pixel_span(size_t n_args, const mp_obj_t *args) {
     return mp_const_none;
 }
 
+mp_obj_t ModPicoGraphics_get_pixel(mp_obj_t self_in, mp_obj_t x, mp_obj_t y) {
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(self_in, ModPicoGraphics_obj_t);
+
+    Point p(mp_obj_get_int(x), mp_obj_get_int(y));
+    if(!self->graphics->bounds.contains(p)) mp_raise_ValueError("Pixel out of bounds!");
+
+    return mp_obj_new_int(self->graphics->get_pixel(p));
+}
+
+mp_obj_t ModPicoGraphics_copy_rect(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h, ARG_dest_x, ARG_dest_y };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->copy_rect({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    }, {
+        mp_obj_get_int(args[ARG_dest_x]),
+        mp_obj_get_int(args[ARG_dest_y])
+    });
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_scroll(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h, ARG_dx, ARG_dy, ARG_fill };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->scroll({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    },  mp_obj_get_int(args[ARG_dx]),
+        mp_obj_get_int(args[ARG_dy]),
+        n_args > ARG_fill ? mp_obj_get_int(args[ARG_fill]) : -1);
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_write_pixels(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h, ARG_data, ARG_format };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    Rect r(
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    );
+    if(r.empty()) return mp_const_none;
+
+    // defaults to the display's own pen type
+    PicoGraphics::PenType format = self->graphics->pen_type;
+    if(n_args > ARG_format) format = (PicoGraphics::PenType)mp_obj_get_int(args[ARG_format]);
+
+    // the paged 1-bit pen takes its pixels in PEN_1BIT rows
+    bool native = format == self->graphics->pen_type
+        || (format == PicoGraphics::PEN_1BIT && self->graphics->pen_type == PicoGraphics::PEN_1BIT_PAGED);
+
+    size_t row = PicoGraphics::row_size(format, r.w);
+    if(row == 0 || (!native && format != PicoGraphics::PEN_RGB888)) {
+        mp_raise_ValueError("Unsupported pixel format!");
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data], &bufinfo, MP_BUFFER_READ);
+    if(bufinfo.len < row * r.h) {
+        mp_raise_ValueError("Supplied buffer is too small!");
+    }
+
+    self->graphics->write_pixels(r, bufinfo.buf, format);
+
+    return mp_const_none;
+}
+
 mp_obj_t ModPicoGraphics_rectangle(size_t n_args, const mp_obj_t *args) {
     enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h };
 
@@ -651,6 +844,135 @@ mp_obj_t ModPicoGraphics_circle(size_t n_args, const mp_obj_t *args) {
     return mp_const_none;
 }
 
+mp_obj_t ModPicoGraphics_circle_outline(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_r };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->circle_outline({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y])
+    },  mp_obj_get_int(args[ARG_r]));
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_ellipse(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_rx, ARG_ry };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->ellipse({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y])
+    },  mp_obj_get_int(args[ARG_rx]), mp_obj_get_int(args[ARG_ry]));
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_ellipse_outline(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_rx, ARG_ry };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->ellipse_outline({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y])
+    },  mp_obj_get_int(args[ARG_rx]), mp_obj_get_int(args[ARG_ry]));
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_rounded_rectangle(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h, ARG_r };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->rounded_rectangle({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y]),
+        mp_obj_get_int(args[ARG_w]),
+        mp_obj_get_int(args[ARG_h])
+    },  mp_obj_get_int(args[ARG_r]));
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_arc(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_r, ARG_thickness, ARG_start, ARG_end };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->arc({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y])
+    },
+        mp_obj_get_int(args[ARG_r]),
+        mp_obj_get_int(args[ARG_thickness]),
+        mp_obj_get_float(args[ARG_start]),
+        mp_obj_get_float(args[ARG_end])
+    );
+
+    return mp_const_none;
+}
+
+static RGB obj_to_rgb(mp_obj_t obj) {
+    if(!mp_obj_is_type(obj, &mp_type_tuple)) mp_raise_TypeError("gradient: colour must be an (r, g, b) tuple");
+
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR2(obj, mp_obj_tuple_t);
+
+    if(tuple->len != 3) mp_raise_ValueError("gradient: tuple must contain R, G, B values");
+
+    return RGB(
+        (uint8_t)mp_obj_get_int(tuple->items[0]),
+        (uint8_t)mp_obj_get_int(tuple->items[1]),
+        (uint8_t)mp_obj_get_int(tuple->items[2])
+    );
+}
+
+mp_obj_t ModPicoGraphics_linear_gradient(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_w, ARG_h, ARG_c0, ARG_c1, ARG_angle };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_w, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_h, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_c0, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_c1, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_angle, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self].u_obj, ModPicoGraphics_obj_t);
+
+    float angle = args[ARG_angle].u_obj == mp_const_none ? 0.0f : mp_obj_get_float(args[ARG_angle].u_obj);
+
+    self->graphics->linear_gradient({
+        args[ARG_x].u_int,
+        args[ARG_y].u_int,
+        args[ARG_w].u_int,
+        args[ARG_h].u_int
+    }, obj_to_rgb(args[ARG_c0].u_obj), obj_to_rgb(args[ARG_c1].u_obj), angle);
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_radial_gradient(size_t n_args, const mp_obj_t *args) {
+    enum { ARG_self, ARG_x, ARG_y, ARG_r, ARG_c0, ARG_c1 };
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self], ModPicoGraphics_obj_t);
+
+    self->graphics->radial_gradient({
+        mp_obj_get_int(args[ARG_x]),
+        mp_obj_get_int(args[ARG_y])
+    },  mp_obj_get_int(args[ARG_r]), obj_to_rgb(args[ARG_c0]), obj_to_rgb(args[ARG_c1]));
+
+    return mp_const_none;
+}
+
 mp_obj_t ModPicoGraphics_character(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_self, ARG_char, ARG_x, ARG_y, ARG_scale };
     static const mp_arg_t allowed_args[] = {
@@ -817,4 +1139,79 @@ mp_obj_t ModPicoGraphics_line(size_t n_args, const mp_obj_t *args) {
 
     return mp_const_none;
 }
+
+mp_obj_t ModPicoGraphics_flood_fill(mp_obj_t self_in, mp_obj_t x, mp_obj_t y) {
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(self_in, ModPicoGraphics_obj_t);
+
+    // the spans waiting to be filled go on the heap, there's more room there
+    // than on the stack
+    const uint stack_size = 512;
+    PicoGraphics::FillSpan *stack = m_new(PicoGraphics::FillSpan, stack_size);
+
+    bool complete = self->graphics->flood_fill({
+        mp_obj_get_int(x),
+        mp_obj_get_int(y)
+    }, stack, stack_size);
+
+    m_del(PicoGraphics::FillSpan, stack, stack_size);
+
+    return complete ? mp_const_true : mp_const_false;
+}
+
+mp_obj_t ModPicoGraphics_fill_path(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_self, ARG_data, ARG_x, ARG_y, ARG_scale };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_x, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_scale, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self].u_obj, ModPicoGraphics_obj_t);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    Path path((const uint8_t *)bufinfo.buf, bufinfo.len);
+    if(!path.valid()) mp_raise_ValueError("fill_path: invalid path data");
+
+    float scale = args[ARG_scale].u_obj == mp_const_none ? 1.0f : mp_obj_get_float(args[ARG_scale].u_obj);
+
+    self->graphics->fill_path(path, Point(args[ARG_x].u_int, args[ARG_y].u_int), scale);
+
+    return mp_const_none;
+}
+
+mp_obj_t ModPicoGraphics_stroke_path(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_self, ARG_data, ARG_width, ARG_x, ARG_y, ARG_scale };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_width, MP_ARG_INT, {.u_int = 1} },
+        { MP_QSTR_x, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_scale, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ModPicoGraphics_obj_t *self = MP_OBJ_TO_PTR2(args[ARG_self].u_obj, ModPicoGraphics_obj_t);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    Path path((const uint8_t *)bufinfo.buf, bufinfo.len);
+    if(!path.valid()) mp_raise_ValueError("stroke_path: invalid path data");
+
+    float scale = args[ARG_scale].u_obj == mp_const_none ? 1.0f : mp_obj_get_float(args[ARG_scale].u_obj);
+
+    self->graphics->stroke_path(path, args[ARG_width].u_int, Point(args[ARG_x].u_int, args[ARG_y].u_int), scale);
+
+    return mp_const_none;
+}
 }
@@ -21,7 +21,10 @@ enum PicoGraphicsPenType {
     PEN_P4,
     PEN_P8,
     PEN_RGB332,
-    PEN_RGB565
+    PEN_RGB565,
+    PEN_RGB565_TILED,
+    PEN_RGB888,
+    PEN_1BIT_PAGED
 };
 
 // Type
@@ -38,6 +41,9 @@ extern mp_obj_t ModPicoGraphics_get_required_buffer_size(mp_obj_t display_in, mp
 extern mp_obj_t ModPicoGraphics_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args);
 
 extern mp_obj_t ModPicoGraphics_update(mp_obj_t self_in);
+extern mp_obj_t ModPicoGraphics_partial_update(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_queue_update(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_update_queued(mp_obj_t self_in);
 extern mp_obj_t ModPicoGraphics_set_backlight(mp_obj_t self_in, mp_obj_t brightness);
 
 // Palette management
@@ -52,17 +58,33 @@ extern mp_obj_t ModPicoGraphics_create_pen(size_t n_args, const mp_obj_t *args);
 // Primitives
 extern mp_obj_t ModPicoGraphics_set_clip(size_t n_args, const mp_obj_t *args);
 extern mp_obj_t ModPicoGraphics_remove_clip(mp_obj_t self_in);
+extern mp_obj_t ModPicoGraphics_push_clip(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_pop_clip(mp_obj_t self_in);
 extern mp_obj_t ModPicoGraphics_clear(mp_obj_t self_in);
 extern mp_obj_t ModPicoGraphics_pixel(mp_obj_t self_in, mp_obj_t x, mp_obj_t y);
 extern mp_obj_t ModPicoGraphics_pixel_span(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_get_pixel(mp_obj_t self_in, mp_obj_t x, mp_obj_t y);
+extern mp_obj_t ModPicoGraphics_copy_rect(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_scroll(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_write_pixels(size_t n_args, const mp_obj_t *args);
 extern mp_obj_t ModPicoGraphics_rectangle(size_t n_args, const mp_obj_t *args);
 extern mp_obj_t ModPicoGraphics_circle(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_circle_outline(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_ellipse(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_ellipse_outline(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_rounded_rectangle(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_arc(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_linear_gradient(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
+extern mp_obj_t ModPicoGraphics_radial_gradient(size_t n_args, const mp_obj_t *args);
 extern mp_obj_t ModPicoGraphics_character(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 extern mp_obj_t ModPicoGraphics_text(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 extern mp_obj_t ModPicoGraphics_measure_text(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 extern mp_obj_t ModPicoGraphics_polygon(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 extern mp_obj_t ModPicoGraphics_triangle(size_t n_args, const mp_obj_t *args);
 extern mp_obj_t ModPicoGraphics_line(size_t n_args, const mp_obj_t *args);
+extern mp_obj_t ModPicoGraphics_flood_fill(mp_obj_t self_in, mp_obj_t x, mp_obj_t y);
+extern mp_obj_t ModPicoGraphics_fill_path(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
+extern mp_obj_t ModPicoGraphics_stroke_path(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 
 // Sprites
 extern mp_obj_t ModPicoGraphics_set_spritesheet(mp_obj_t self_in, mp_obj_t spritedata);